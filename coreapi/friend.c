@@ -995,6 +995,10 @@ void linphone_friend_update_subscribes(LinphoneFriend *fr, bool_t only_when_regi
 			}
 		}
 	}
+	if (can_subscribe && fr->subscribe && fr->lc && L_GET_PRIVATE_FROM_C_OBJECT(fr->lc)->areStartupTasksDeferred()) {
+		ms_message("Subscription of friend [%p] deferred until the end of the startup tasks", fr);
+		can_subscribe = 0;
+	}
 	if (can_subscribe && fr->subscribe && fr->subscribe_active == FALSE) {
 		ms_message("Sending a new SUBSCRIBE for friend [%p]", fr);
 		__linphone_friend_do_subscribe(fr);
@@ -1124,6 +1128,11 @@ void linphone_core_remove_friend(BCTBX_UNUSED(LinphoneCore *lc), LinphoneFriend
 }
 
 void linphone_core_update_friends_subscriptions(LinphoneCore *lc) {
+	// Presence is not needed to receive the call or message a push notification woke the core up for.
+	if (L_GET_PRIVATE_FROM_C_OBJECT(lc)->areStartupTasksDeferred()) {
+		ms_message("Friend lists subscriptions deferred until the end of the startup tasks");
+		return;
+	}
 	bctbx_list_t *lists = lc->friends_lists;
 	while (lists) {
 		LinphoneFriendList *list = (LinphoneFriendList *)bctbx_list_get_data(lists);
@@ -112,6 +112,7 @@
 #include "call/call.h"
 #include "conference/params/media-session-params-p.h"
 
+#include "sal/potential_config_graph.h"
 #include "sal/sal.h"
 
 #ifdef HAVE_ZLIB
@@ -1763,6 +1764,10 @@ static void sip_config_read(LinphoneCore *lc) {
 
 	Sal::setTLSWellKnownPort(linphone_config_get_int(lc->config, "sip", "sip_tls_well_known_port", 5061));
 
+	lc->sal->setMaxPotentialConfigurations(static_cast<unsigned int>(
+	    MAX(1, linphone_config_get_int(lc->config, "sip", "max_potential_configurations",
+	                                   (int)PotentialCfgGraph::defaultMaxConfigurationsPerStream))));
+
 	certificates_config_read(lc);
 	/*setting the dscp must be done before starting the transports, otherwise it is not taken into effect*/
 	lc->sal->setDscp(linphone_core_get_sip_dscp(lc));
@@ -2526,7 +2531,7 @@ static void misc_config_read(LinphoneCore *lc) {
 		} else linphone_friend_list_ref(lc->base_contacts_list_for_synchronization);
 
 		linphone_friend_list_set_type(lc->base_contacts_list_for_synchronization, LinphoneFriendListTypeVCard4);
-		linphone_friend_list_synchronize_friends_from_server(lc->base_contacts_list_for_synchronization);
+		// The synchronization itself is a startup task, see CorePrivate::runStartupTasks().
 	}
 }
 
@@ -2586,6 +2591,13 @@ void linphone_core_load_config_from_xml(LinphoneCore *lc, const char *xml_uri) {
 }
 
 void linphone_configuring_terminated(LinphoneCore *lc, LinphoneConfiguringState state, const char *message) {
+	_linphone_configuring_terminated(lc, state, message, TRUE);
+}
+
+void _linphone_configuring_terminated(LinphoneCore *lc,
+                                      LinphoneConfiguringState state,
+                                      const char *message,
+                                      bool_t config_changed) {
 	linphone_core_notify_configuring_status(lc, state, message);
 
 	if (state == LinphoneConfiguringSuccessful) {
@@ -2593,10 +2605,12 @@ void linphone_configuring_terminated(LinphoneCore *lc, LinphoneConfiguringState
 			linphone_core_set_provisioning_uri(lc, NULL);
 		}
 
-		_linphone_core_read_config(lc);
+		if (config_changed) {
+			_linphone_core_read_config(lc);
 
-		// To apply any changes to LIME configuration
-		linphone_core_reload_lime(lc);
+			// To apply any changes to LIME configuration
+			linphone_core_reload_lime(lc);
+		}
 	}
 
 	if (lc->provisioning_http_listener) {
@@ -2605,8 +2619,7 @@ void linphone_configuring_terminated(LinphoneCore *lc, LinphoneConfiguringState
 	}
 
 	_linphone_core_apply_transports(lc); // This will create SIP sockets.
-	L_GET_PRIVATE_FROM_C_OBJECT(lc)->initEphemeralMessages();
-	L_GET_PRIVATE_FROM_C_OBJECT(lc)->reloadLdapList();
+	L_GET_PRIVATE_FROM_C_OBJECT(lc)->runStartupTasks();
 	linphone_core_set_state(lc, LinphoneGlobalOn, "On");
 }
 
@@ -3107,7 +3120,8 @@ static void linphone_core_init(LinphoneCore *lc,
 	lc->data = userdata;
 
 	// We need the Sal on the Android platform helper init
-	lc->sal = std::make_shared<LinphonePrivate::Sal>(nullptr);
+	lc->sal = std::make_shared<LinphonePrivate::Sal>(
+	    nullptr, L_C_TO_STRING(linphone_config_get_string(lc->config, "misc", "core_group", NULL)));
 #if defined(PACKAGE_NAME) && defined(LIBLINPHONE_VERSION)
 	lc->sal->setUserAgent(
 	    linphone_config_get_string(lc->config, "sip", "user_agent", PACKAGE_NAME "/" LIBLINPHONE_VERSION));
@@ -4191,6 +4205,7 @@ static void notify_network_reachable_change(LinphoneCore *lc) {
 static void proxy_update(LinphoneCore *lc) {
 	bctbx_list_t *elem, *next;
 	bctbx_list_for_each(lc->sip_conf.proxies, (void (*)(void *)) & linphone_proxy_config_update);
+	Account::startScheduledRegistrations(lc);
 	for (elem = lc->sip_conf.deleted_proxies; elem != NULL; elem = next) {
 		LinphoneProxyConfig *cfg = (LinphoneProxyConfig *)elem->data;
 		next = elem->next;
@@ -4337,8 +4352,7 @@ void linphone_core_iterate(LinphoneCore *lc) {
 
 	proxy_update(lc);
 
-	/* We have to iterate for each call */
-	L_GET_PRIVATE_FROM_C_OBJECT(lc)->iterateCalls(current_real_time, one_second_elapsed);
+	/* Call sessions timeouts are handled by their own timers, see CallSessionPrivate::updateDeadlineTimer() */
 
 	if (linphone_core_video_preview_enabled(lc)) {
 		if (lc->previewstream == NULL && !L_GET_PRIVATE_FROM_C_OBJECT(lc)->hasCalls()) toggle_video_preview(lc, TRUE);
@@ -4383,6 +4397,61 @@ void linphone_core_iterate(LinphoneCore *lc) {
 	}
 }
 
+/* Iterate period used while something is polled from linphone_core_iterate(), and upper bound when idle. */
+#define LINPHONE_CORE_ACTIVE_ITERATE_DELAY_MS 20
+#define LINPHONE_CORE_IDLE_ITERATE_DELAY_MS 1000
+
+static bool_t linphone_core_needs_frequent_iterate(LinphoneCore *lc) {
+	const bctbx_list_t *elem;
+
+	if (lc->state == LinphoneGlobalStartup || lc->state == LinphoneGlobalConfiguring ||
+	    lc->state == LinphoneGlobalShutdown)
+		return TRUE;
+	/* Media related tasks report through the mediastreamer event queue, which is only pumped by iterate. */
+	if (lc->ecc || lc->previewstream || linphone_core_video_preview_enabled(lc) ||
+	    (lc->ringtoneplayer && linphone_ringtoneplayer_is_started(lc->ringtoneplayer)) ||
+	    L_GET_PRIVATE_FROM_C_OBJECT(lc)->hasCalls())
+		return TRUE;
+	if (lc->hooks.hooks || lc->bl_refresh || lc->bl_reqs || liblinphone_serialize_logs) return TRUE;
+	for (elem = lc->sip_conf.proxies; elem != NULL; elem = elem->next) {
+		LinphoneProxyConfig *cfg = (LinphoneProxyConfig *)elem->data;
+		if (Account::toCpp(cfg->account)->hasPendingUpdate()) return TRUE;
+	}
+	return FALSE;
+}
+
+int linphone_core_get_next_iterate_delay(LinphoneCore *lc) {
+	int delay = LINPHONE_CORE_IDLE_ITERATE_DELAY_MS;
+
+	if (lc->preview_finished) return 0;
+	if (linphone_core_needs_frequent_iterate(lc)) return LINPHONE_CORE_ACTIVE_ITERATE_DELAY_MS;
+	if (!lc->initial_subscribes_sent && lc->sip_network_state.global_state && lc->netup_time != 0) {
+		time_t remaining = lc->netup_time + 2 - ms_time(NULL);
+		if (remaining <= 0) return 0;
+		delay = MIN(delay, (int)remaining * 1000);
+	}
+	return delay;
+}
+
+void linphone_core_wait_for_events(LinphoneCore *lc, int timeout_ms) {
+	int delay = LINPHONE_CORE_IDLE_ITERATE_DELAY_MS;
+
+	if (lc->sal) {
+		/* Cores of a same group share the SIP stack: the wait must honor the deadlines of all of them. */
+		for (LinphonePrivate::Sal *member : lc->sal->getGroupMembers()) {
+			LinphoneCore *core = (LinphoneCore *)member->getUserPointer();
+			if (core) delay = MIN(delay, linphone_core_get_next_iterate_delay(core));
+		}
+	} else {
+		delay = linphone_core_get_next_iterate_delay(lc);
+	}
+
+	if (timeout_ms >= 0) delay = MIN(delay, timeout_ms);
+	if (delay <= 0) return;
+	if (lc->sal) lc->sal->iterate((unsigned int)delay);
+	else ms_usleep((uint64_t)delay * 1000);
+}
+
 LinphoneAddress *linphone_core_interpret_url(LinphoneCore *lc, const char *url) {
 	return linphone_core_interpret_url_2(lc, url, TRUE);
 }
@@ -5120,6 +5189,7 @@ void linphone_core_set_inc_timeout(LinphoneCore *lc, int seconds) {
 	lc->sip_conf.inc_timeout = seconds;
 	if (linphone_core_ready(lc)) {
 		linphone_config_set_int(lc->config, "sip", "inc_timeout", seconds);
+		L_GET_PRIVATE_FROM_C_OBJECT(lc)->updateCallDeadlines();
 	}
 }
 
@@ -5131,6 +5201,7 @@ void linphone_core_set_push_incoming_call_timeout(LinphoneCore *lc, int seconds)
 	lc->sip_conf.push_incoming_call_timeout = seconds;
 	if (linphone_core_ready(lc)) {
 		linphone_config_set_int(lc->config, "sip", "push_incoming_call_timeout", seconds);
+		L_GET_PRIVATE_FROM_C_OBJECT(lc)->updateCallDeadlines();
 	}
 }
 
@@ -5142,6 +5213,7 @@ void linphone_core_set_in_call_timeout(LinphoneCore *lc, int seconds) {
 	lc->sip_conf.in_call_timeout = seconds;
 	if (linphone_core_ready(lc)) {
 		linphone_config_set_int(lc->config, "sip", "in_call_timeout", seconds);
+		L_GET_PRIVATE_FROM_C_OBJECT(lc)->updateCallDeadlines();
 	}
 }
 
@@ -5155,6 +5227,7 @@ int linphone_core_get_delayed_timeout(LinphoneCore *lc) {
 
 void linphone_core_set_delayed_timeout(LinphoneCore *lc, int seconds) {
 	lc->sip_conf.delayed_timeout = seconds;
+	if (linphone_core_ready(lc)) L_GET_PRIVATE_FROM_C_OBJECT(lc)->updateCallDeadlines();
 }
 
 int linphone_core_get_max_size_for_auto_download_incoming_files(LinphoneCore *lc) {
@@ -105,6 +105,7 @@ struct _LpConfig {
 	char *factory_filename;
 	bctbx_list_t *sections;
 	bctbx_vfs_t *g_bctbx_vfs;
+	unsigned int revision; // Bumped on every change of the in-memory content, see linphone_config_get_revision()
 	bool_t modified;
 	bool_t readonly;
 	bool_t abort_sync;
@@ -414,6 +415,7 @@ int linphone_config_parse(LpConfig *lpconfig, bctbx_vfs_file_t *pFile) {
 		current_section = linphone_config_parse_line(lpconfig, tmp, current_section);
 		total_size += size;
 	}
+	lpconfig->revision++;
 	return total_size;
 }
 
@@ -573,24 +575,17 @@ static const char *empty_xml = "empty provisioning file";
 static const char *xml_to_lpc_failed = "xml to lpc failed";
 static const char *invalid_xml = "invalid xml";
 
-static const char *_linphone_config_xml_convert(LpConfig *lpc, xml2lpc_context *context, int result) {
-	const char *error_msg = NULL;
+static const char *_linphone_config_xml_converted(LpConfig *lpc, int result) {
 	if (result == 0) {
-		result = xml2lpc_convert(context, lpc);
-		if (result == 0) {
-			// if the remote provisioning added a proxy config and none was set before, set it
-			if (linphone_config_has_section(lpc, "proxy_0") &&
-			    linphone_config_get_int(lpc, "sip", "default_proxy", -1) == -1) {
-				linphone_config_set_int(lpc, "sip", "default_proxy", 0);
-			}
-			linphone_config_sync(lpc);
-		} else {
-			error_msg = xml_to_lpc_failed;
+		// if the remote provisioning added a proxy config and none was set before, set it
+		if (linphone_config_has_section(lpc, "proxy_0") &&
+		    linphone_config_get_int(lpc, "sip", "default_proxy", -1) == -1) {
+			linphone_config_set_int(lpc, "sip", "default_proxy", 0);
 		}
-	} else {
-		error_msg = invalid_xml;
+		linphone_config_sync(lpc);
+		return NULL;
 	}
-	return error_msg;
+	return (result == -1) ? invalid_xml : xml_to_lpc_failed;
 }
 
 const char *linphone_config_load_from_xml_file(LinphoneConfig *lpc, const char *filename) {
@@ -600,7 +595,7 @@ const char *linphone_config_load_from_xml_file(LinphoneConfig *lpc, const char *
 
 	if (path) {
 		context = xml2lpc_context_new(NULL, NULL);
-		error_msg = _linphone_config_xml_convert(lpc, context, xml2lpc_set_xml_file(context, path));
+		error_msg = _linphone_config_xml_converted(lpc, xml2lpc_convert_xml_file(context, lpc, path));
 		bctbx_free(path);
 	}
 	if (context) xml2lpc_context_destroy(context);
@@ -643,7 +638,7 @@ const char *_linphone_config_load_from_xml_string(LpConfig *lpc, const char *buf
 
 	if (buffer != NULL) {
 		context = xml2lpc_context_new(xml2lpc_callback, NULL);
-		error_msg = _linphone_config_xml_convert(lpc, context, xml2lpc_set_xml_string(context, buffer));
+		error_msg = _linphone_config_xml_converted(lpc, xml2lpc_convert_xml_string(context, lpc, buffer));
 	} else {
 		error_msg = empty_xml;
 	}
@@ -872,6 +867,7 @@ void linphone_config_set_string(LpConfig *lpconfig, const char *section, const c
 		lp_section_add_item(sec, lp_item_new(key, value));
 	}
 	lpconfig->modified = TRUE;
+	lpconfig->revision++;
 }
 
 void linphone_config_set_string_list(LpConfig *lpconfig,
@@ -1061,6 +1057,7 @@ void linphone_config_reload(LinphoneConfig *lpconfig) {
 	bctbx_list_for_each(lpconfig->sections, (void (*)(void *))lp_section_destroy);
 	bctbx_list_free(lpconfig->sections);
 	lpconfig->sections = NULL;
+	lpconfig->revision++;
 	linphone_config_read_file(lpconfig, lpconfig->filename);
 }
 
@@ -1101,12 +1098,17 @@ void linphone_config_clean_section(LpConfig *lpconfig, const char *section) {
 		linphone_config_remove_section(lpconfig, sec);
 	}
 	lpconfig->modified = TRUE;
+	lpconfig->revision++;
 }
 
 bool_t linphone_config_needs_commit(const LpConfig *lpconfig) {
 	return lpconfig->modified;
 }
 
+unsigned int linphone_config_get_revision(const LpConfig *lpconfig) {
+	return lpconfig->revision;
+}
+
 static const char *DEFAULT_VALUES_SUFFIX = "_default_values";
 
 int linphone_config_get_default_int(const LpConfig *lpconfig, const char *section, const char *key, int default_value) {
@@ -1375,7 +1377,10 @@ void linphone_config_clean_entry(LpConfig *lpconfig, const char *section, const
 	sec = linphone_config_find_section(lpconfig, section);
 	if (sec != NULL) {
 		item = lp_section_find_item(sec, key);
-		if (item != NULL) lp_section_remove_item(sec, item);
+		if (item != NULL) {
+			lp_section_remove_item(sec, item);
+			lpconfig->revision++;
+		}
 	}
 	return;
 }
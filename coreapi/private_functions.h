@@ -447,6 +447,9 @@ void linphone_conference_scheduler_notify_state_changed(LinphoneConferenceSchedu
                                                         LinphoneConferenceSchedulerState state);
 void linphone_conference_scheduler_notify_invitations_sent(LinphoneConferenceScheduler *conference_scheduler,
                                                            const bctbx_list_t *failed_invites);
+void linphone_conference_scheduler_notify_invitations_progress(LinphoneConferenceScheduler *conference_scheduler,
+                                                               unsigned int processed_invitations,
+                                                               unsigned int total_invitations);
 
 LINPHONE_PUBLIC void linphone_participant_device_set_state(LinphoneParticipantDevice *participant_device,
                                                            LinphoneParticipantDeviceState state);
@@ -693,6 +696,12 @@ LINPHONE_PUBLIC int linphone_friend_get_rc_index(const LinphoneFriend *lf);
  ****************************************************************************/
 
 void linphone_configuring_terminated(LinphoneCore *lc, LinphoneConfiguringState state, const char *message);
+/* Same as linphone_configuring_terminated(), config_changed being FALSE when the provisioning left the config as it was
+ * read at startup. */
+void _linphone_configuring_terminated(LinphoneCore *lc,
+                                      LinphoneConfiguringState state,
+                                      const char *message,
+                                      bool_t config_changed);
 int linphone_remote_provisioning_download_and_apply(LinphoneCore *lc,
                                                     const char *remote_provisioning_uri,
                                                     const bctbx_list_t *remote_provisioning_headers);
@@ -941,6 +950,8 @@ LinphoneVideoDefinition *linphone_factory_find_supported_video_definition_by_nam
 
 const char *_linphone_config_load_from_xml_string(LpConfig *lpc, const char *buffer);
 void _linphone_config_apply_factory_config(LpConfig *config);
+/* Returns a counter that changes each time the in-memory content of the config is modified. */
+unsigned int linphone_config_get_revision(const LpConfig *config);
 
 SalCustomHeader *linphone_info_message_get_headers(const LinphoneInfoMessage *im);
 void linphone_info_message_set_headers(LinphoneInfoMessage *im, const SalCustomHeader *headers);
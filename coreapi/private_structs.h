@@ -700,6 +700,8 @@ class Core;
 	belle_http_provider_t *http_provider;                                                                              \
 	belle_tls_crypto_config_t *http_crypto_config;                                                                     \
 	belle_http_request_listener_t *provisioning_http_listener;                                                         \
+	uint64_t provisioning_start_time;                                                                                  \
+	uint64_t provisioning_duration;                                                                                    \
 	belle_http_request_listener_t *base_contacts_list_http_listener;                                                   \
 	LinphoneFriendList *base_contacts_list_for_synchronization;                                                        \
 	MSList *tones;                                                                                                     \
@@ -46,8 +46,10 @@
 #include "c-wrapper/c-wrapper.h"
 #include "call/call-log.h"
 #include "call/call.h"
+#include "call/quality-report-aggregator.h"
 #include "conference/session/media-session-p.h"
-#include "event/event.h"
+#include "content/content.h"
+#include "core/core-p.h"
 
 #define STR_REASSIGN(dest, src)                                                                                        \
 	{                                                                                                                  \
@@ -86,8 +88,8 @@ static void append_to_buffer_valist(char **buff, size_t *buff_size, size_t *offs
 		/*some compilers complain that size_t cannot be formatted as unsigned long, hence forcing cast*/
 		ms_debug(
 		    "QualityReporting: Buffer was too small to contain the whole report - increasing its size from %lu to %lu",
-		    (unsigned long)*buff_size, (unsigned long)*buff_size + 2048);
-		*buff_size += 2048;
+		    (unsigned long)*buff_size, (unsigned long)*buff_size * 2);
+		*buff_size *= 2;
 		*buff = (char *)ms_realloc(*buff, *buff_size);
 
 		*offset = prevoffset;
@@ -306,17 +308,18 @@ append_metrics_to_buffer(char **buffer, size_t *size, size_t *offset, const repo
 	ms_free(moscq_str);
 }
 
+/*largest report buffer needed so far: reports have about the same size during a session, so starting with this one
+avoids growing the buffer again for every report*/
+static size_t report_buffer_size_hint = 2048;
+
 static int send_report(LinphoneCall *call, reporting_session_report_t *report, const char *report_event) {
 	LinphoneContent *content;
 	size_t offset = 0;
-	size_t size = 2048;
+	size_t size = report_buffer_size_hint;
 	char *buffer;
 	int ret = 0;
-	LinphoneEvent *lev;
-	LinphoneAddress *request_uri;
 	const char *collector_uri;
 	char *collector_uri_allocated = NULL;
-	const SalAddress *salAddress;
 	const LinphoneAccount *dest_account = NULL;
 	const LinphoneAccountParams *dest_account_params = NULL;
 
@@ -391,8 +394,9 @@ static int send_report(LinphoneCall *call, reporting_session_report_t *report, c
 	}
 #endif
 
-	linphone_content_set_buffer(content, (uint8_t *)buffer, strlen(buffer));
+	linphone_content_set_buffer(content, (uint8_t *)buffer, offset);
 	ms_free(buffer);
+	if (size > report_buffer_size_hint) report_buffer_size_hint = size;
 
 	if (Call::toCpp(call)->getLog()->getQualityReporting()->on_report_sent != NULL) {
 		SalStreamType type = report == Call::toCpp(call)->getLog()->getQualityReporting()->reports[0]   ? SalAudio
@@ -408,20 +412,8 @@ static int send_report(LinphoneCall *call, reporting_session_report_t *report, c
 		collector_uri = collector_uri_allocated =
 		    ms_strdup_printf("sip:%s", linphone_account_params_get_domain(dest_account_params));
 	}
-	request_uri = linphone_address_new(collector_uri);
-	lev = linphone_core_create_one_shot_publish(linphone_call_get_core(call), request_uri, "vq-rtcpxr");
-	/* Special exception for quality report PUBLISH: if the collector_uri has any transport related parameters
-	 * (port, transport, maddr), then it is sent directly.
-	 * Otherwise it is routed as any LinphoneEvent publish, following proxy config policy.
-	 **/
-	salAddress = LinphonePrivate::Address::toCpp(request_uri)->getImpl();
-	if (sal_address_has_uri_param(salAddress, "transport") || sal_address_has_uri_param(salAddress, "maddr") ||
-	    linphone_address_get_port(request_uri) != 0) {
-		ms_message("Publishing report with custom route %s", collector_uri);
-		Event::toCpp(lev)->getOp()->setRoute(collector_uri);
-	}
-
-	if (linphone_event_send_publish(lev, content) != 0) {
+	if (L_GET_PRIVATE_FROM_C_OBJECT(linphone_call_get_core(call))
+	        ->qualityReportAggregator->add(collector_uri, *L_GET_CPP_PTR_FROM_C_OBJECT(content)) != 0) {
 		ret = 4;
 	} else {
 		reset_avg_metrics(report);
@@ -431,7 +423,6 @@ static int send_report(LinphoneCall *call, reporting_session_report_t *report, c
 		STR_REASSIGN(report->qos_analyzer.output_leg, NULL);
 		STR_REASSIGN(report->qos_analyzer.output, NULL);
 	}
-	linphone_address_unref(request_uri);
 	linphone_content_unref(content);
 	if (collector_uri_allocated) ms_free(collector_uri_allocated);
 
@@ -18,6 +18,7 @@
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <bctoolbox/crypto.h>
 #include <bctoolbox/defs.h>
 
 #include "linphone/lpconfig.h"
@@ -26,14 +27,28 @@
 
 #define XML2LPC_CALLBACK_BUFFER_SIZE 1024
 
+static void linphone_remote_provisioning_terminated(LinphoneCore *lc,
+                                                    LinphoneConfiguringState state,
+                                                    const char *message,
+                                                    bool_t config_changed) {
+	if (lc->provisioning_start_time != 0) {
+		lc->provisioning_duration = bctbx_get_cur_time_ms() - lc->provisioning_start_time;
+		lc->provisioning_start_time = 0;
+		ms_message("Remote provisioning terminated with state [%s] in %llu ms%s",
+		           linphone_configuring_state_to_string(state), (unsigned long long)lc->provisioning_duration,
+		           config_changed ? "" : ", configuration unchanged");
+	}
+	_linphone_configuring_terminated(lc, state, message, config_changed);
+}
+
 static void belle_request_process_io_error(void *ctx, BCTBX_UNUSED(const belle_sip_io_error_event_t *event)) {
 	LinphoneCore *lc = (LinphoneCore *)ctx;
-	linphone_configuring_terminated(lc, LinphoneConfiguringFailed, "http io error");
+	linphone_remote_provisioning_terminated(lc, LinphoneConfiguringFailed, "http io error", TRUE);
 }
 
 static void belle_request_process_timeout(void *ctx, BCTBX_UNUSED(const belle_sip_timeout_event_t *event)) {
 	LinphoneCore *lc = (LinphoneCore *)ctx;
-	linphone_configuring_terminated(lc, LinphoneConfiguringFailed, "http timeout");
+	linphone_remote_provisioning_terminated(lc, LinphoneConfiguringFailed, "http timeout", TRUE);
 }
 
 static void belle_request_process_auth_requested(void *ctx, belle_sip_auth_event_t *event) {
@@ -48,13 +63,17 @@ static void belle_request_process_auth_requested(void *ctx, belle_sip_auth_event
 	linphone_auth_info_fill_belle_sip_event(auth_info, event);
 }
 
-static void linphone_remote_provisioning_apply(LinphoneCore *lc, const char *xml) {
-	LinphoneConfig *config = linphone_core_get_config(lc);
+static const char *linphone_remote_provisioning_load(LinphoneConfig *config, const char *xml) {
 	const char *error_msg = _linphone_config_load_from_xml_string(config, xml);
 
 	_linphone_config_apply_factory_config(config);
-	linphone_configuring_terminated(lc, error_msg ? LinphoneConfiguringFailed : LinphoneConfiguringSuccessful,
-	                                error_msg);
+	return error_msg;
+}
+
+static void linphone_remote_provisioning_apply(LinphoneCore *lc, const char *xml) {
+	const char *error_msg = linphone_remote_provisioning_load(linphone_core_get_config(lc), xml);
+	linphone_remote_provisioning_terminated(lc, error_msg ? LinphoneConfiguringFailed : LinphoneConfiguringSuccessful,
+	                                        error_msg, TRUE);
 }
 
 int linphone_remote_provisioning_load_file(LinphoneCore *lc, const char *file_path) {
@@ -69,18 +88,101 @@ int linphone_remote_provisioning_load_file(LinphoneCore *lc, const char *file_pa
 	return status;
 }
 
+/*
+ * The last provisioning that was applied is described in the [misc] section of the config, which also holds its result:
+ * - config-uri-cached: the URI it was downloaded from,
+ * - config-uri-etag and config-uri-last-modified: the validators sent by the server, used for a conditional GET,
+ * - config-uri-md5: the digest of the body, in case the server does not support conditional requests.
+ * When the body did not change, it is not applied again. This is only done when [misc] config-uri-cache is enabled,
+ * because local changes of provisioned values are then kept instead of being overwritten by the server's values.
+ */
+static bool_t linphone_remote_provisioning_cache_enabled(const LinphoneCore *lc) {
+	return !!linphone_config_get_bool(lc->config, "misc", "config-uri-cache", FALSE);
+}
+
+static bool_t linphone_remote_provisioning_cache_valid(const LinphoneCore *lc, const char *remote_provisioning_uri) {
+	const char *cached_uri = linphone_config_get_string(lc->config, "misc", "config-uri-cached", NULL);
+	return linphone_remote_provisioning_cache_enabled(lc) && cached_uri && remote_provisioning_uri &&
+	       (strcmp(cached_uri, remote_provisioning_uri) == 0);
+}
+
+static void linphone_remote_provisioning_clear_cache(LinphoneCore *lc) {
+	linphone_config_clean_entry(lc->config, "misc", "config-uri-cached");
+	linphone_config_clean_entry(lc->config, "misc", "config-uri-etag");
+	linphone_config_clean_entry(lc->config, "misc", "config-uri-last-modified");
+	linphone_config_clean_entry(lc->config, "misc", "config-uri-md5");
+}
+
+static char *linphone_remote_provisioning_digest(const char *body) {
+	unsigned char digest[16];
+	char *hex = reinterpret_cast<char *>(ms_malloc(2 * sizeof(digest) + 1));
+
+	bctbx_md5((const unsigned char *)body, strlen(body), digest);
+	for (size_t i = 0; i < sizeof(digest); i++)
+		snprintf(hex + 2 * i, 3, "%02x", digest[i]);
+	return hex;
+}
+
+static void linphone_remote_provisioning_store_validator(LinphoneCore *lc,
+                                                         belle_sip_message_t *message,
+                                                         const char *header_name,
+                                                         const char *key) {
+	belle_sip_header_t *header = belle_sip_message_get_header(message, header_name);
+	const char *value = header ? belle_sip_header_get_unparsed_value(header) : NULL;
+	if (value) linphone_config_set_string(lc->config, "misc", key, value);
+	else linphone_config_clean_entry(lc->config, "misc", key);
+}
+
+static void linphone_remote_provisioning_add_validator(LinphoneCore *lc,
+                                                       belle_http_request_t *request,
+                                                       const char *key,
+                                                       const char *header_name) {
+	const char *value = linphone_config_get_string(lc->config, "misc", key, NULL);
+	if (value) belle_sip_message_add_header(BELLE_SIP_MESSAGE(request), belle_http_header_create(header_name, value));
+}
+
 static void belle_request_process_response_event(void *ctx, const belle_http_response_event_t *event) {
 	LinphoneCore *lc = (LinphoneCore *)ctx;
 	belle_sip_message_t *message = BELLE_SIP_MESSAGE(event->response);
 	const char *body = belle_sip_message_get_body(message);
+	const char *uri = linphone_core_get_provisioning_uri(lc);
 
 	int statusCode = belle_http_response_get_status_code(event->response);
-	if (statusCode == 200) {
-		linphone_remote_provisioning_apply(lc, body);
+	if (statusCode == 304 && linphone_remote_provisioning_cache_valid(lc, uri)) {
+		ms_message("Remote provisioning from [%s] not modified, keeping current configuration", uri);
+		linphone_remote_provisioning_terminated(lc, LinphoneConfiguringSuccessful, NULL, FALSE);
+	} else if (statusCode == 200) {
+		if (!body || !linphone_remote_provisioning_cache_enabled(lc)) {
+			linphone_remote_provisioning_apply(lc, body);
+			return;
+		}
+
+		char *digest = linphone_remote_provisioning_digest(body);
+		const char *cached_digest = linphone_config_get_string(lc->config, "misc", "config-uri-md5", NULL);
+		bool_t config_changed = !linphone_remote_provisioning_cache_valid(lc, uri) || !cached_digest ||
+		                        (strcmp(cached_digest, digest) != 0);
+		const char *error_msg = NULL;
+		if (config_changed) {
+			error_msg = linphone_remote_provisioning_load(lc->config, body);
+		} else {
+			ms_message("Remote provisioning from [%s] did not change, keeping current configuration", uri);
+		}
+
+		if (error_msg) {
+			linphone_remote_provisioning_clear_cache(lc);
+		} else {
+			linphone_config_set_string(lc->config, "misc", "config-uri-cached", uri);
+			linphone_config_set_string(lc->config, "misc", "config-uri-md5", digest);
+			linphone_remote_provisioning_store_validator(lc, message, "ETag", "config-uri-etag");
+			linphone_remote_provisioning_store_validator(lc, message, "Last-Modified", "config-uri-last-modified");
+		}
+		ms_free(digest);
+		LinphoneConfiguringState state = error_msg ? LinphoneConfiguringFailed : LinphoneConfiguringSuccessful;
+		linphone_remote_provisioning_terminated(lc, state, error_msg, config_changed);
 	} else if (statusCode == 401) {
-		linphone_configuring_terminated(lc, LinphoneConfiguringFailed, "http auth requested");
+		linphone_remote_provisioning_terminated(lc, LinphoneConfiguringFailed, "http auth requested", TRUE);
 	} else {
-		linphone_configuring_terminated(lc, LinphoneConfiguringFailed, "http error");
+		linphone_remote_provisioning_terminated(lc, LinphoneConfiguringFailed, "http error", TRUE);
 	}
 }
 
@@ -91,6 +193,7 @@ int linphone_remote_provisioning_download_and_apply(LinphoneCore *lc,
 	const char *scheme = uri ? belle_generic_uri_get_scheme(uri) : NULL;
 	const char *host = uri ? belle_generic_uri_get_host(uri) : NULL;
 
+	lc->provisioning_start_time = bctbx_get_cur_time_ms();
 	if (scheme && (strcmp(scheme, "file") == 0)) {
 		// We allow for 'local remote-provisioning' in case the file is to be opened from the hard drive.
 		const char *file_path = remote_provisioning_uri + strlen("file://"); // skip scheme
@@ -114,6 +217,11 @@ int linphone_remote_provisioning_download_and_apply(LinphoneCore *lc,
 		request = belle_http_request_create(
 		    "GET", uri, belle_sip_header_create("User-Agent", linphone_core_get_user_agent(lc)), NULL);
 
+		if (linphone_remote_provisioning_cache_valid(lc, remote_provisioning_uri)) {
+			linphone_remote_provisioning_add_validator(lc, request, "config-uri-etag", "If-None-Match");
+			linphone_remote_provisioning_add_validator(lc, request, "config-uri-last-modified", "If-Modified-Since");
+		}
+
 		const bctbx_list_t *header_it = remote_provisioning_headers;
 		while (header_it) {
 			const bctbx_list_t *pair_value = (const bctbx_list_t *)bctbx_list_get_data(header_it);
@@ -134,6 +242,7 @@ int linphone_remote_provisioning_download_and_apply(LinphoneCore *lc,
 		return belle_http_provider_send_request(lc->http_provider, request, lc->provisioning_http_listener);
 	} else {
 		ms_error("Invalid provisioning URI [%s] (missing scheme or host ?)", remote_provisioning_uri);
+		lc->provisioning_start_time = 0;
 		if (uri) {
 			belle_sip_object_unref(uri);
 		}
@@ -59,6 +59,10 @@ belle_http_provider_t *linphone_core_get_http_provider(const LinphoneCore *lc) {
 	return lc->http_provider;
 }
 
+uint64_t linphone_core_get_provisioning_duration(const LinphoneCore *lc) {
+	return lc->provisioning_duration;
+}
+
 void linphone_core_enable_send_call_stats_periodical_updates(LinphoneCore *lc, bool_t enabled) {
 	lc->send_call_stats_periodical_updates = enabled;
 }
@@ -245,6 +249,10 @@ void linphone_core_reset_shared_core_state(LinphoneCore *lc) {
 	static_cast<PlatformHelpers *>(lc->platform_helper)->getSharedCoreHelpers()->resetSharedCoreState();
 }
 
+bool_t linphone_core_startup_tasks_deferred(const LinphoneCore *lc) {
+	return L_GET_PRIVATE_FROM_C_OBJECT(lc)->areStartupTasksDeferred();
+}
+
 char *linphone_core_get_download_path(LinphoneCore *lc) {
 	return bctbx_strdup(L_GET_CPP_PTR_FROM_C_OBJECT(lc)->getDownloadPath().c_str());
 }
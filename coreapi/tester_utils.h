@@ -104,6 +104,7 @@ LINPHONE_PUBLIC int linphone_core_get_local_ip_for(int type, const char *dest, c
 LINPHONE_PUBLIC void linphone_core_enable_forced_ice_relay(LinphoneCore *lc, bool_t enable);
 LINPHONE_PUBLIC void linphone_core_set_zrtp_not_available_simulation(LinphoneCore *lc, bool_t enabled);
 LINPHONE_PUBLIC belle_http_provider_t *linphone_core_get_http_provider(const LinphoneCore *lc);
+LINPHONE_PUBLIC uint64_t linphone_core_get_provisioning_duration(const LinphoneCore *lc);
 LINPHONE_PUBLIC IceSession *linphone_call_get_ice_session(const LinphoneCall *call);
 LINPHONE_PUBLIC const struct addrinfo *linphone_core_get_stun_server_addrinfo(LinphoneCore *lc);
 LINPHONE_PUBLIC void linphone_core_enable_send_call_stats_periodical_updates(LinphoneCore *lc, bool_t enabled);
@@ -297,6 +298,7 @@ LINPHONE_PUBLIC void linphone_core_set_network_reachable_internal(LinphoneCore *
 
 LINPHONE_PUBLIC bctbx_list_t *linphone_fetch_local_addresses(void);
 LINPHONE_PUBLIC void linphone_core_reset_shared_core_state(LinphoneCore *lc);
+LINPHONE_PUBLIC bool_t linphone_core_startup_tasks_deferred(const LinphoneCore *lc);
 LINPHONE_PUBLIC char *linphone_core_get_download_path(LinphoneCore *lc);
 
 LINPHONE_PUBLIC const char *linphone_core_get_conference_version(const LinphoneCore *lc);
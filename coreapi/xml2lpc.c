@@ -128,6 +128,21 @@ static void dumpContent(xmlNode *node, xml2lpc_context *ctx) {
 	else xml2lpc_log(ctx, XML2LPC_DEBUG, "content: ");
 }
 
+static void applyEntry(
+    const char *sectionName, const char *name, const char *value, bool_t overwrite, long line, xml2lpc_context *ctx) {
+	if (name != NULL) {
+		const char *str = linphone_config_get_string(ctx->lpc, sectionName, name, NULL);
+		if (str == NULL || overwrite) {
+			xml2lpc_log(ctx, XML2LPC_MESSAGE, "Set %s|%s = %s", sectionName, name, value);
+			linphone_config_set_string(ctx->lpc, sectionName, name, value);
+		} else {
+			xml2lpc_log(ctx, XML2LPC_MESSAGE, "Don't touch %s|%s = %s", sectionName, name, str);
+		}
+	} else {
+		xml2lpc_log(ctx, XML2LPC_WARNING, "ignored entry with no \"name\" attribute line:%ld", line);
+	}
+}
+
 static int processEntry(xmlElement *element, const char *sectionName, xml2lpc_context *ctx) {
 	xmlNode *cur_attr = NULL;
 	const char *name = NULL;
@@ -149,18 +164,7 @@ static int processEntry(xmlElement *element, const char *sectionName, xml2lpc_co
 	if (element->children) value = (const char *)element->children->content;
 	else value = "";
 
-	if (name != NULL) {
-		const char *str = linphone_config_get_string(ctx->lpc, sectionName, name, NULL);
-		if (str == NULL || overwrite) {
-			xml2lpc_log(ctx, XML2LPC_MESSAGE, "Set %s|%s = %s", sectionName, name, value);
-			linphone_config_set_string(ctx->lpc, sectionName, name, value);
-		} else {
-			xml2lpc_log(ctx, XML2LPC_MESSAGE, "Don't touch %s|%s = %s", sectionName, name, str);
-		}
-	} else {
-		xml2lpc_log(ctx, XML2LPC_WARNING, "ignored entry with no \"name\" attribute line:%d",
-		            xmlGetLineNo((xmlNode *)element));
-	}
+	applyEntry(sectionName, name, value, overwrite, xmlGetLineNo((xmlNode *)element), ctx);
 	return 0;
 }
 
@@ -261,6 +265,100 @@ int xml2lpc_convert(xml2lpc_context *xmlCtx, LpConfig *lpc) {
 	return internal_convert_xml2lpc(xmlCtx);
 }
 
+static xmlTextReaderPtr xml2lpc_new_reader(const char *content, const char *filename) {
+	if (content != NULL) return xmlReaderForMemory(content, (int)strlen(content), NULL, NULL, 0);
+	return xmlReaderForFile(filename, NULL, 0);
+}
+
+/*
+ * Walks the document with a xmlTextReader, which only keeps the current node in memory. When ctx->lpc is NULL, the
+ * document is only checked.
+ */
+static int processStream(xmlTextReaderPtr reader, xml2lpc_context *ctx) {
+	bool_t inConfig = FALSE;
+	xmlChar *sectionName = NULL;
+	int ret;
+
+	while ((ret = xmlTextReaderRead(reader)) == 1) {
+		if (xmlTextReaderNodeType(reader) != XML_READER_TYPE_ELEMENT) continue;
+
+		const char *nodeName = (const char *)xmlTextReaderConstLocalName(reader);
+		int depth = xmlTextReaderDepth(reader);
+		if (depth == 0) {
+			inConfig = (strcmp(nodeName, "config") == 0);
+			if (!inConfig && ctx->lpc) {
+				xml2lpc_log(ctx, XML2LPC_WARNING, "root element is not \"config\", line:%d",
+				            xmlTextReaderGetParserLineNumber(reader));
+			}
+		} else if (depth == 1) {
+			if (sectionName != NULL) {
+				xmlFree(sectionName);
+				sectionName = NULL;
+			}
+			if (!inConfig || !ctx->lpc || strcmp(nodeName, "section") != 0) continue;
+			sectionName = xmlTextReaderGetAttribute(reader, (const xmlChar *)"name");
+			if (sectionName == NULL) {
+				xml2lpc_log(ctx, XML2LPC_WARNING, "ignored section with no \"name\" attribute, line:%d",
+				            xmlTextReaderGetParserLineNumber(reader));
+			}
+		} else if ((depth == 2) && (sectionName != NULL) && (strcmp(nodeName, "entry") == 0)) {
+			xmlChar *name = xmlTextReaderGetAttribute(reader, (const xmlChar *)"name");
+			xmlChar *overwrite = xmlTextReaderGetAttribute(reader, (const xmlChar *)"overwrite");
+			long line = xmlTextReaderGetParserLineNumber(reader);
+			xmlChar *value = xmlTextReaderIsEmptyElement(reader) ? NULL : xmlTextReaderReadString(reader);
+			applyEntry((const char *)sectionName, (const char *)name, value ? (const char *)value : "",
+			           overwrite && (strcmp((const char *)overwrite, "true") == 0), line, ctx);
+			if (name) xmlFree(name);
+			if (overwrite) xmlFree(overwrite);
+			if (value) xmlFree(value);
+		}
+	}
+	if (sectionName != NULL) xmlFree(sectionName);
+	return ret == 0 ? 0 : -1;
+}
+
+static int streamDoc(xml2lpc_context *xmlCtx, const char *content, const char *filename) {
+	xmlTextReaderPtr reader = xml2lpc_new_reader(content, filename);
+	int ret = reader ? processStream(reader, xmlCtx) : -1;
+
+	if (reader) xmlFreeTextReader(reader);
+	if (ret != 0) {
+		if (content) xml2lpc_log(xmlCtx, XML2LPC_ERROR, "Can't parse string");
+		else xml2lpc_log(xmlCtx, XML2LPC_ERROR, "Can't open/parse file \"%s\"", filename);
+		xml2lpc_log(xmlCtx, XML2LPC_ERROR, "%s", xmlCtx->errorBuffer);
+	}
+	return ret;
+}
+
+static int internal_stream_xml2lpc(xml2lpc_context *xmlCtx, LpConfig *lpc, const char *content, const char *filename) {
+	int ret;
+
+	xml2lpc_context_clear_logs(xmlCtx);
+	xmlSetGenericErrorFunc(xmlCtx, xml2lpc_genericxml_error);
+	if (lpc == NULL) {
+		xml2lpc_log(xmlCtx, XML2LPC_ERROR, "Invalid lpc");
+		return -2;
+	}
+
+	// Check the whole document first, so that an invalid or truncated one leaves the config untouched.
+	xmlCtx->lpc = NULL;
+	if (streamDoc(xmlCtx, content, filename) != 0) return -1;
+
+	xml2lpc_log(xmlCtx, XML2LPC_DEBUG, "Parse started");
+	xmlCtx->lpc = lpc;
+	ret = streamDoc(xmlCtx, content, filename);
+	xml2lpc_log(xmlCtx, XML2LPC_DEBUG, "Parse ended ret:%d", ret);
+	return ret;
+}
+
+int xml2lpc_convert_xml_string(xml2lpc_context *xmlCtx, LpConfig *lpc, const char *content) {
+	return internal_stream_xml2lpc(xmlCtx, lpc, content, NULL);
+}
+
+int xml2lpc_convert_xml_file(xml2lpc_context *xmlCtx, LpConfig *lpc, const char *filename) {
+	return internal_stream_xml2lpc(xmlCtx, lpc, NULL, filename);
+}
+
 int xml2lpc_set_xml_file(xml2lpc_context *xmlCtx, const char *filename) {
 	xml2lpc_context_clear_logs(xmlCtx);
 	xmlSetGenericErrorFunc(xmlCtx, xml2lpc_genericxml_error);
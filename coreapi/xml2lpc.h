@@ -52,6 +52,14 @@ LINPHONE_PUBLIC int xml2lpc_set_xsd_string(xml2lpc_context *context, const char
 LINPHONE_PUBLIC int xml2lpc_validate(xml2lpc_context *context);
 LINPHONE_PUBLIC int xml2lpc_convert(xml2lpc_context *context, LpConfig *lpc);
 
+/*
+ * Convert the document while it is read, without building its tree, so that memory does not grow with the size of the
+ * document. The document is read twice: it is checked first, so that an invalid document leaves lpc untouched.
+ * Return 0 on success, -1 if the document can't be read or parsed, -2 if lpc is invalid.
+ */
+LINPHONE_PUBLIC int xml2lpc_convert_xml_string(xml2lpc_context *context, LpConfig *lpc, const char *content);
+LINPHONE_PUBLIC int xml2lpc_convert_xml_file(xml2lpc_context *context, LpConfig *lpc, const char *filename);
+
 #ifdef __cplusplus
 }
 #endif
@@ -750,6 +750,17 @@ typedef void (*LinphoneConferenceSchedulerCbsStateChangedCb)(LinphoneConferenceS
 typedef void (*LinphoneConferenceSchedulerCbsInvitationsSentCb)(LinphoneConferenceScheduler *conference_scheduler,
                                                                 const bctbx_list_t *failed_invitations);
 
+/**
+ * Callback for notifying the progress of the sending of conference invitations.
+ * It is called each time the invitation of a participant has been delivered or has failed.
+ * @param conference_scheduler #LinphoneConferenceScheduler object sending the invitations. @notnil
+ * @param processed_invitations The number of invitations delivered or failed so far.
+ * @param total_invitations The number of invitations to send.
+ */
+typedef void (*LinphoneConferenceSchedulerCbsInvitationsProgressCb)(LinphoneConferenceScheduler *conference_scheduler,
+                                                                    unsigned int processed_invitations,
+                                                                    unsigned int total_invitations);
+
 /**
  * @}
  **/
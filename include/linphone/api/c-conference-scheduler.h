@@ -204,6 +204,23 @@ LINPHONE_PUBLIC void
 linphone_conference_scheduler_cbs_set_invitations_sent(LinphoneConferenceSchedulerCbs *cbs,
                                                        LinphoneConferenceSchedulerCbsInvitationsSentCb cb);
 
+/**
+ * Get the invitations progress callback.
+ * @param cbs #LinphoneConferenceSchedulerCbs object. @notnil
+ * @return The current invitations progress callback.
+ */
+LINPHONE_PUBLIC LinphoneConferenceSchedulerCbsInvitationsProgressCb
+linphone_conference_scheduler_cbs_get_invitations_progress(const LinphoneConferenceSchedulerCbs *cbs);
+
+/**
+ * Set the invitations progress callback.
+ * @param cbs #LinphoneConferenceSchedulerCbs object. @notnil
+ * @param cb The invitations progress callback to be used.
+ */
+LINPHONE_PUBLIC void
+linphone_conference_scheduler_cbs_set_invitations_progress(LinphoneConferenceSchedulerCbs *cbs,
+                                                           LinphoneConferenceSchedulerCbsInvitationsProgressCb cb);
+
 /**
  * @}
  */
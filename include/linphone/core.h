@@ -1442,6 +1442,46 @@ LINPHONE_PUBLIC void linphone_core_unref(LinphoneCore *core);
  **/
 LINPHONE_PUBLIC void linphone_core_iterate(LinphoneCore *core);
 
+/**
+ * Returns the maximum delay after which linphone_core_iterate() must be called again.
+ *
+ * Together with linphone_core_wait_for_events(), this allows an application to call linphone_core_iterate() only when
+ * there is work to do, instead of every 20ms. The returned delay is short while calls, video preview, ringtone
+ * playback or other media related tasks are running, and up to one second when the core is idle. SIP messages and
+ * timers do not shorten it: they are handled by linphone_core_wait_for_events().
+ * @param core #LinphoneCore object @notnil
+ * @return The delay in milliseconds, 0 if linphone_core_iterate() must be called immediately.
+ * @ingroup initializing
+ **/
+LINPHONE_PUBLIC int linphone_core_get_next_iterate_delay(LinphoneCore *core);
+
+/**
+ * Blocks until the core has work to do, dispatching incoming SIP messages and expired timers meanwhile.
+ *
+ * The function returns as soon as a SIP message, a SIP transaction timeout or a SIP transport error has been
+ * dispatched, or when the delay given by linphone_core_get_next_iterate_delay() or timeout_ms elapses. Other events
+ * processed during the wait, such as HTTP transfers and timers, do not end it: their follow-up work in
+ * linphone_core_iterate() may then be postponed until that delay elapses. linphone_core_iterate() must be called
+ * afterwards.
+ * A typical event-driven main loop is:
+ * @code
+ * while (running) {
+ * 	linphone_core_wait_for_events(core, -1);
+ * 	linphone_core_iterate(core);
+ * }
+ * @endcode
+ * This function must be called from the thread that calls linphone_core_iterate().
+ *
+ * Cores created with the same "core_group" value in the "misc" section of their configuration share a single SIP
+ * stack and event loop. Waiting on any of them then waits for the whole group, and all the cores of the group must be
+ * iterated afterwards, from the same thread. SIP stack wide settings (DNS, TLS, transport timeouts) are shared as well.
+ * This allows a single process to host many user agents without one polling loop per core.
+ * @param core #LinphoneCore object @notnil
+ * @param timeout_ms The maximum time to wait in milliseconds, or -1 to only use the core's own deadline.
+ * @ingroup initializing
+ **/
+LINPHONE_PUBLIC void linphone_core_wait_for_events(LinphoneCore *core, int timeout_ms);
+
 /**
  * @ingroup initializing
  * Add a listener in order to be notified of #LinphoneCore events. Once an event is received, registred #LinphoneCoreCbs
@@ -3443,6 +3483,20 @@ LINPHONE_PUBLIC bctbx_list_t *linphone_core_get_call_history_2(LinphoneCore *cor
                                                                const LinphoneAddress *peer_address,
                                                                const LinphoneAddress *local_address);
 
+/**
+ * Get a page of the call logs (past calls), most recent first.
+ * To get the next page, pass the last call log of the current page as @p after.
+ * Only the requested page is loaded from the database, so this is the way to display a long call history.
+ * It is your responsibility to unref the logs and free this list once you are done using it.
+ * Requires ENABLE_DB_STORAGE to work.
+ * @param core #LinphoneCore object. @notnil
+ * @param after The #LinphoneCallLog after which the page starts, NULL for the first page. @maybenil
+ * @param limit The maximum number of call logs in the page.
+ * @return A list of #LinphoneCallLog. \bctbx_list{LinphoneCallLog} @tobefreed @maybenil
+ **/
+LINPHONE_PUBLIC bctbx_list_t *
+linphone_core_get_call_history_page(LinphoneCore *core, const LinphoneCallLog *after, int limit);
+
 /**
  * Get the latest outgoing call log.
  * Conference calls are not returned by this function!
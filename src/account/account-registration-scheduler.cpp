@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2010-2022 Belledonne Communications SARL.
+ *
+ * This file is part of Liblinphone
+ * (see https://gitlab.linphone.org/BC/public/liblinphone).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+
+#include "bctoolbox/port.h"
+
+#include "account-registration-scheduler.h"
+#include "logger/logger.h"
+
+// =============================================================================
+
+using namespace std;
+
+LINPHONE_BEGIN_NAMESPACE
+
+AccountRegistrationScheduler::AccountRegistrationScheduler(size_t maxInFlight,
+                                                           uint64_t spreadMs,
+                                                           uint64_t slotDurationMs,
+                                                           size_t slotCount)
+    : mMaxInFlight(maxInFlight), mSpreadMs(spreadMs), mSlotDurationMs(max<uint64_t>(slotDurationMs, 1)),
+      mSlots(max<size_t>(slotCount, 1)) {
+}
+
+void AccountRegistrationScheduler::schedule(Key key, uint64_t nowMs) {
+	scheduleAt(key, nowMs + (mSpreadMs > 0 ? bctbx_random() % mSpreadMs : 0));
+}
+
+void AccountRegistrationScheduler::scheduleAt(Key key, uint64_t deadlineMs) {
+	// Already due, it keeps its place in the queue.
+	if (find(mReady.begin(), mReady.end(), key) != mReady.end()) return;
+
+	auto it = mScheduled.find(key);
+	if (it != mScheduled.end()) {
+		mSlots[it->second.first].erase(it->second.second);
+		mScheduled.erase(it);
+	}
+
+	// A deadline that is already over goes into the current slot, which is looked at again on next collect.
+	uint64_t tick = deadlineMs / mSlotDurationMs;
+	if (mStarted) tick = max(tick, mCurrentTick);
+	const size_t index = static_cast<size_t>(tick % mSlots.size());
+	Slot &slot = mSlots[index];
+	mScheduled[key] = make_pair(index, slot.insert(slot.end(), {key, deadlineMs}));
+}
+
+void AccountRegistrationScheduler::unschedule(Key key) {
+	auto it = mScheduled.find(key);
+	if (it != mScheduled.end()) {
+		mSlots[it->second.first].erase(it->second.second);
+		mScheduled.erase(it);
+	}
+	mReady.remove(key);
+	mInFlight.erase(key);
+}
+
+bool AccountRegistrationScheduler::isScheduled(Key key) const {
+	return (mScheduled.find(key) != mScheduled.end()) || (find(mReady.begin(), mReady.end(), key) != mReady.end());
+}
+
+size_t AccountRegistrationScheduler::getScheduledCount() const {
+	return mScheduled.size() + mReady.size();
+}
+
+void AccountRegistrationScheduler::advance(uint64_t nowMs) {
+	const uint64_t nowTick = nowMs / mSlotDurationMs;
+	const size_t slotCount = mSlots.size();
+
+	// Visit the slots from the one of the previous collect up to the current one. After a long pause (or before the
+	// first collect), every slot is visited once.
+	uint64_t firstTick = nowTick;
+	size_t visitedCount = 1;
+	if (!mStarted || (nowTick >= mCurrentTick + slotCount)) {
+		firstTick = nowTick + 1;
+		visitedCount = slotCount;
+	} else if (nowTick > mCurrentTick) {
+		firstTick = mCurrentTick;
+		visitedCount = static_cast<size_t>(nowTick - mCurrentTick + 1);
+	}
+
+	vector<Entry> due;
+	for (size_t i = 0; i < visitedCount; i++) {
+		Slot &slot = mSlots[static_cast<size_t>((firstTick + i) % slotCount)];
+		for (auto it = slot.begin(); it != slot.end();) {
+			// Entries of the slot may belong to a later turn of the wheel.
+			if (it->deadline <= nowMs) {
+				due.push_back(*it);
+				mScheduled.erase(it->key);
+				it = slot.erase(it);
+			} else {
+				++it;
+			}
+		}
+	}
+	stable_sort(due.begin(), due.end(), [](const Entry &a, const Entry &b) { return a.deadline < b.deadline; });
+	for (const auto &entry : due)
+		mReady.push_back(entry.key);
+
+	mCurrentTick = nowTick;
+	mStarted = true;
+}
+
+list<AccountRegistrationScheduler::Key> AccountRegistrationScheduler::collectDue(uint64_t nowMs) {
+	for (auto it = mInFlight.begin(); it != mInFlight.end();) {
+		if (nowMs >= it->second + transactionTimeoutMs) {
+			lWarning() << "Registration of [" << it->first << "] got no final answer after " << transactionTimeoutMs
+			           << " ms, no longer counting it as in-flight";
+			it = mInFlight.erase(it);
+		} else {
+			++it;
+		}
+	}
+
+	advance(nowMs);
+
+	list<Key> started;
+	while (!mReady.empty() && ((mMaxInFlight == 0) || (mInFlight.size() < mMaxInFlight))) {
+		Key key = mReady.front();
+		mReady.pop_front();
+		mInFlight[key] = nowMs;
+		started.push_back(key);
+	}
+	mPeakInFlight = max(mPeakInFlight, mInFlight.size());
+	return started;
+}
+
+void AccountRegistrationScheduler::transactionFinished(Key key) {
+	mInFlight.erase(key);
+}
+
+LINPHONE_END_NAMESPACE
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2010-2022 Belledonne Communications SARL.
+ *
+ * This file is part of Liblinphone
+ * (see https://gitlab.linphone.org/BC/public/liblinphone).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _L_ACCOUNT_REGISTRATION_SCHEDULER_H_
+#define _L_ACCOUNT_REGISTRATION_SCHEDULER_H_
+
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#include "linphone/utils/general.h"
+
+// =============================================================================
+
+LINPHONE_BEGIN_NAMESPACE
+
+/*
+ * Decides when the accounts of a core send their REGISTER, so that a core hosting many accounts does not hit the
+ * registrar with all of them at once.
+ * Each registration is delayed by a random amount within the spread window, and its deadline is kept in a hashed
+ * timer wheel: only the slots whose time has come are looked at, instead of every account. Due registrations are
+ * then started in deadline order while less than maxInFlight of them are waiting for their final answer.
+ * Times are given in milliseconds by the caller.
+ */
+class LINPHONE_PUBLIC AccountRegistrationScheduler {
+public:
+	using Key = void *;
+
+	// A maxInFlight of 0 means no limit.
+	AccountRegistrationScheduler(size_t maxInFlight,
+	                             uint64_t spreadMs,
+	                             uint64_t slotDurationMs = 100,
+	                             size_t slotCount = 512);
+
+	// Schedules the registration of key somewhere within the spread window starting at nowMs.
+	void schedule(Key key, uint64_t nowMs);
+	void scheduleAt(Key key, uint64_t deadlineMs);
+	// Forgets everything about key: pending deadline as well as in-flight registration.
+	void unschedule(Key key);
+	bool isScheduled(Key key) const;
+
+	// Returns the keys whose registration must be started now. They are accounted as in-flight until
+	// transactionFinished() is called, or until the SIP transaction timeout is over.
+	std::list<Key> collectDue(uint64_t nowMs);
+	void transactionFinished(Key key);
+
+	size_t getScheduledCount() const;
+	size_t getInFlightCount() const {
+		return mInFlight.size();
+	}
+	size_t getPeakInFlightCount() const {
+		return mPeakInFlight;
+	}
+
+private:
+	// Time after which a registration that got no final answer no longer holds an in-flight slot (64*T1).
+	static constexpr uint64_t transactionTimeoutMs = 32000;
+
+	struct Entry {
+		Key key;
+		uint64_t deadline;
+	};
+	using Slot = std::list<Entry>;
+
+	void advance(uint64_t nowMs);
+
+	size_t mMaxInFlight;
+	uint64_t mSpreadMs;
+	uint64_t mSlotDurationMs;
+	std::vector<Slot> mSlots;
+	uint64_t mCurrentTick = 0;
+	bool mStarted = false;
+
+	std::unordered_map<Key, std::pair<size_t, Slot::iterator>> mScheduled;
+	// Due registrations waiting for an in-flight slot, in deadline order
+	std::list<Key> mReady;
+	// Start time of the registrations waiting for their final answer
+	std::unordered_map<Key, uint64_t> mInFlight;
+	size_t mPeakInFlight = 0;
+};
+
+LINPHONE_END_NAMESPACE
+
+#endif // ifndef _L_ACCOUNT_REGISTRATION_SCHEDULER_H_
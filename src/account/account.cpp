@@ -19,7 +19,9 @@
  */
 
 #include "account.h"
+#include "account-registration-scheduler.h"
 
+#include "core/core-p.h"
 #include "core/core.h"
 #include "linphone/api/c-account-params.h"
 #include "linphone/api/c-account.h"
@@ -65,6 +67,7 @@ Account::~Account() {
 	setDependency(nullptr);
 	if (mErrorInfo) linphone_error_info_unref(mErrorInfo);
 	if (mPresenceModel) linphone_presence_model_unref(mPresenceModel);
+	if (auto scheduler = mRegistrationScheduler.lock()) scheduler->unschedule(this);
 
 	releaseOps();
 }
@@ -364,6 +367,9 @@ void Account::setState(LinphoneRegistrationState state, const std::string &messa
 
 		LinphoneRegistrationState previousState = mState;
 		mState = state;
+		if (previousState == LinphoneRegistrationProgress) {
+			if (auto scheduler = mRegistrationScheduler.lock()) scheduler->transactionFinished(this);
+		}
 		if (!mDependency) {
 			updateDependentAccount(state, message);
 		}
@@ -899,8 +905,20 @@ int Account::done() {
 void Account::update() {
 	if (mNeedToRegister) {
 		if (canRegister()) {
-			registerAccount();
-			mNeedToRegister = false;
+			auto scheduler = mCore ? L_GET_PRIVATE_FROM_C_OBJECT(mCore)->registrationScheduler : nullptr;
+			if (scheduler && mParams->mRegisterEnabled) {
+				if (!mRegisterScheduled) {
+					scheduler->schedule(this, bctbx_get_cur_time_ms());
+					mRegisterScheduled = true;
+					mRegistrationScheduler = scheduler;
+				}
+			} else {
+				// Unregistration is not delayed.
+				if (mRegisterScheduled && scheduler) scheduler->unschedule(this);
+				mRegisterScheduled = false;
+				registerAccount();
+				mNeedToRegister = false;
+			}
 		}
 	}
 	if (mSendPublish && (mState == LinphoneRegistrationOk || mState == LinphoneRegistrationCleared)) {
@@ -912,6 +930,26 @@ void Account::update() {
 	}
 }
 
+bool Account::hasPendingUpdate() const {
+	return mNeedToRegister || mSendPublish;
+}
+
+void Account::startScheduledRegistrations(LinphoneCore *lc) {
+	auto scheduler = L_GET_PRIVATE_FROM_C_OBJECT(lc)->registrationScheduler;
+	if (!scheduler) return;
+	for (auto key : scheduler->collectDue(bctbx_get_cur_time_ms())) {
+		Account *account = static_cast<Account *>(key);
+		account->mRegisterScheduled = false;
+		// Things may have changed since the registration was scheduled, it will be scheduled again if needed.
+		const bool removed = bctbx_list_find(lc->sip_conf.deleted_accounts, account->toC()) != nullptr;
+		if (!removed && account->mNeedToRegister && account->canRegister()) {
+			account->registerAccount();
+			account->mNeedToRegister = false;
+		}
+		if (account->mState != LinphoneRegistrationProgress) scheduler->transactionFinished(key);
+	}
+}
+
 void Account::apply(LinphoneCore *lc) {
 	mOldParams = nullptr; // remove old params to make sure we will register since we only call apply when adding
 	                      // accounts to core
@@ -41,6 +41,7 @@ typedef enum _LinphoneAccountAddressComparisonResult {
 } LinphoneAccountAddressComparisonResult;
 
 class AccountCbs;
+class AccountRegistrationScheduler;
 
 class Account : public bellesip::HybridObject<LinphoneAccount, Account>,
                 public UserDataAccessor,
@@ -109,6 +110,9 @@ public:
 	void unpublish();
 	void unregister();
 	void update();
+	bool hasPendingUpdate() const;
+	// Sends the REGISTER of the accounts of the core whose turn has come, see AccountRegistrationScheduler.
+	static void startScheduledRegistrations(LinphoneCore *lc);
 	void addCustomParam(const std::string &key, const std::string &value);
 	const std::string &getCustomParam(const std::string &key) const;
 	void writeToConfigFile(int index);
@@ -155,6 +159,7 @@ private:
 	bool mNeedToRegister = false;
 	bool mRegisterChanged = false;
 	bool mSendPublish = false;
+	bool mRegisterScheduled = false;
 
 	time_t mDeletionDate;
 
@@ -179,6 +184,8 @@ private:
 
 	std::shared_ptr<Account> mDependency = nullptr;
 
+	std::weak_ptr<AccountRegistrationScheduler> mRegistrationScheduler;
+
 	unsigned long long mPreviousPublishParamsHash[2] = {0};
 	std::shared_ptr<AccountParams> mOldParams;
 
@@ -285,7 +285,10 @@ const bctbx_list_t *linphone_core_get_call_history(LinphoneCore *lc) {
 	if (!mainDb) return lc->call_logs;
 
 	if (lc->call_logs != NULL) {
+		// Only the most recent logs are kept in memory, use linphone_core_get_call_history_page() to go further.
 		size_t callLogsDatabaseSize = (size_t)mainDb->getCallHistorySize();
+		if (lc->max_call_logs >= 0 && callLogsDatabaseSize > (size_t)lc->max_call_logs)
+			callLogsDatabaseSize = (size_t)lc->max_call_logs;
 		if (bctbx_list_size(lc->call_logs) >= callLogsDatabaseSize) return lc->call_logs;
 		// If some call logs were added to the Core before the full history was loaded from database,
 		// clean memory cache and reload everything from database
@@ -407,6 +410,29 @@ bctbx_list_t *linphone_core_get_call_history_2(LinphoneCore *lc,
 #endif
 }
 
+bctbx_list_t *linphone_core_get_call_history_page(LinphoneCore *lc, const LinphoneCallLog *after, int limit) {
+	if (!lc) return NULL;
+
+#ifdef HAVE_DB_STORAGE
+	std::unique_ptr<MainDb> &mainDb = L_GET_PRIVATE_FROM_C_OBJECT(lc)->mainDb;
+	if (!mainDb) return NULL;
+
+	std::shared_ptr<CallLog> afterLog =
+	    after ? CallLog::toCpp(const_cast<LinphoneCallLog *>(after))->getSharedFromThis() : nullptr;
+	auto list = mainDb->getCallHistoryPage(afterLog, limit);
+
+	bctbx_list_t *results = NULL;
+	for (auto &log : list) {
+		results = bctbx_list_append(results, linphone_call_log_ref(log->toC()));
+	}
+
+	return results;
+#else
+	bctbx_fatal("This function requires ENABLE_DB_STORAGE in order to work!");
+	return NULL;
+#endif
+}
+
 LinphoneCallLog *linphone_core_get_last_outgoing_call_log(LinphoneCore *lc) {
 	if (!lc) return NULL;
 
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2010-2022 Belledonne Communications SARL.
+ *
+ * This file is part of Liblinphone
+ * (see https://gitlab.linphone.org/BC/public/liblinphone).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "call-registry.h"
+
+#include "address/address.h"
+#include "call/call-log.h"
+#include "call/call.h"
+
+// =============================================================================
+
+using namespace std;
+
+LINPHONE_BEGIN_NAMESPACE
+
+void CallRegistry::add(const shared_ptr<Call> &call) {
+	if (mEntries.find(call.get()) != mEntries.end()) return;
+	Entry entry;
+	entry.position = mCalls.insert(mCalls.end(), call);
+	entry.rank = mNextRank++;
+	index(call.get(), entry);
+	mEntries.emplace(call.get(), std::move(entry));
+}
+
+bool CallRegistry::remove(const shared_ptr<Call> &call) {
+	auto it = mEntries.find(call.get());
+	if (it == mEntries.end()) return false;
+	unindex(call.get(), it->second);
+	if (mIterating && mCursor == it->second.position) ++mCursor;
+	mCalls.erase(it->second.position);
+	mEntries.erase(it);
+	return true;
+}
+
+void CallRegistry::update(const Call *call) {
+	auto it = mEntries.find(call);
+	if (it == mEntries.end()) return;
+	unindex(call, it->second);
+	index(call, it->second);
+}
+
+shared_ptr<Call> CallRegistry::findByCallId(const string &callId) const {
+	if (callId.empty()) return nullptr;
+	return findOldest(mCallsByCallId, callId, nullptr);
+}
+
+shared_ptr<Call> CallRegistry::findByRemoteAddress(const Address &address,
+                                                   const function<bool(const shared_ptr<Call> &)> &filter) const {
+	// Keys may collide, weakEqual() has the final say.
+	auto matches = [&address, &filter](const shared_ptr<Call> &call) {
+		const auto remoteAddress = call->getRemoteAddress();
+		return remoteAddress && remoteAddress->weakEqual(address) && (!filter || filter(call));
+	};
+	return findOldest(mCallsByRemoteAddress, getRemoteAddressKey(address), matches);
+}
+
+shared_ptr<Call> CallRegistry::findOldest(const unordered_multimap<string, const Call *> &calls,
+                                          const string &key,
+                                          const function<bool(const shared_ptr<Call> &)> &filter) const {
+	shared_ptr<Call> result;
+	uint64_t resultRank = 0;
+	auto range = calls.equal_range(key);
+	for (auto it = range.first; it != range.second; ++it) {
+		const Entry &entry = mEntries.at(it->second);
+		if (result && (entry.rank > resultRank)) continue;
+		const shared_ptr<Call> &call = *entry.position;
+		if (filter && !filter(call)) continue;
+		result = call;
+		resultRank = entry.rank;
+	}
+	return result;
+}
+
+void CallRegistry::forEach(const function<void(const shared_ptr<Call> &)> &function) const {
+	if (mIterating) {
+		// Nested loop, the cursor is already in use.
+		list<shared_ptr<Call>> calls(mCalls);
+		for (const auto &call : calls)
+			function(call);
+		return;
+	}
+
+	mIterating = true;
+	mCursor = mCalls.cbegin();
+	try {
+		while (mCursor != mCalls.cend()) {
+			// Keep a reference, the call may be removed from the registry by the function.
+			shared_ptr<Call> call = *mCursor;
+			++mCursor;
+			function(call);
+		}
+	} catch (...) {
+		mIterating = false;
+		throw;
+	}
+	mIterating = false;
+}
+
+string CallRegistry::getRemoteAddressKey(const Address &address) {
+	// Same fields as Address::weakEqual().
+	return address.getUsername() + "@" + address.getDomain() + ":" + to_string(address.getPort());
+}
+
+void CallRegistry::index(const Call *call, Entry &entry) {
+	auto log = call->getLog();
+	auto remoteAddress = call->getRemoteAddress();
+	entry.callId = log ? log->getCallId() : string();
+	entry.remoteAddressKey = remoteAddress ? getRemoteAddressKey(*remoteAddress) : string();
+	if (!entry.callId.empty()) mCallsByCallId.emplace(entry.callId, call);
+	if (!entry.remoteAddressKey.empty()) mCallsByRemoteAddress.emplace(entry.remoteAddressKey, call);
+}
+
+void CallRegistry::unindex(const Call *call, const Entry &entry) {
+	unindex(mCallsByCallId, entry.callId, call);
+	unindex(mCallsByRemoteAddress, entry.remoteAddressKey, call);
+}
+
+void CallRegistry::unindex(unordered_multimap<string, const Call *> &calls, const string &key, const Call *call) {
+	auto range = calls.equal_range(key);
+	for (auto it = range.first; it != range.second; ++it) {
+		if (it->second == call) {
+			calls.erase(it);
+			return;
+		}
+	}
+}
+
+LINPHONE_END_NAMESPACE
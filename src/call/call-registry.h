@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2010-2022 Belledonne Communications SARL.
+ *
+ * This file is part of Liblinphone
+ * (see https://gitlab.linphone.org/BC/public/liblinphone).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _L_CALL_REGISTRY_H_
+#define _L_CALL_REGISTRY_H_
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "linphone/utils/general.h"
+
+// =============================================================================
+
+LINPHONE_BEGIN_NAMESPACE
+
+class Address;
+class Call;
+
+/*
+ * Calls of a core, kept in creation order and indexed by Call-ID and by remote address so that lookups do not scan
+ * every call. The indexes of a call are computed when it is added and must be refreshed with update() whenever its
+ * Call-ID or remote address may have changed, which is the case on each of its state changes.
+ */
+class CallRegistry {
+public:
+	CallRegistry() = default;
+
+	void add(const std::shared_ptr<Call> &call);
+	bool remove(const std::shared_ptr<Call> &call);
+	void update(const Call *call);
+
+	const std::list<std::shared_ptr<Call>> &getCalls() const {
+		return mCalls;
+	}
+
+	std::list<std::shared_ptr<Call>>::const_iterator begin() const {
+		return mCalls.cbegin();
+	}
+
+	std::list<std::shared_ptr<Call>>::const_iterator end() const {
+		return mCalls.cend();
+	}
+
+	bool empty() const {
+		return mCalls.empty();
+	}
+
+	size_t size() const {
+		return mCalls.size();
+	}
+
+	std::shared_ptr<Call> findByCallId(const std::string &callId) const;
+	// Returns the oldest call whose remote address weakly equals the given one and that is accepted by the filter.
+	std::shared_ptr<Call>
+	findByRemoteAddress(const Address &address,
+	                    const std::function<bool(const std::shared_ptr<Call> &)> &filter = nullptr) const;
+
+	// Calls the function on each call without copying the list. A call removed by the function is not visited
+	// anymore, a call added by it is visited at the end of the loop.
+	void forEach(const std::function<void(const std::shared_ptr<Call> &)> &function) const;
+
+private:
+	struct Entry {
+		std::list<std::shared_ptr<Call>>::const_iterator position;
+		uint64_t rank;
+		std::string callId;
+		std::string remoteAddressKey;
+	};
+
+	static std::string getRemoteAddressKey(const Address &address);
+	static void
+	unindex(std::unordered_multimap<std::string, const Call *> &calls, const std::string &key, const Call *call);
+
+	std::shared_ptr<Call> findOldest(const std::unordered_multimap<std::string, const Call *> &calls,
+	                                 const std::string &key,
+	                                 const std::function<bool(const std::shared_ptr<Call> &)> &filter) const;
+	void index(const Call *call, Entry &entry);
+	void unindex(const Call *call, const Entry &entry);
+
+	std::list<std::shared_ptr<Call>> mCalls;
+	std::unordered_map<const Call *, Entry> mEntries;
+	std::unordered_multimap<std::string, const Call *> mCallsByCallId;
+	std::unordered_multimap<std::string, const Call *> mCallsByRemoteAddress;
+	uint64_t mNextRank = 0;
+
+	mutable std::list<std::shared_ptr<Call>>::const_iterator mCursor;
+	mutable bool mIterating = false;
+
+	L_DISABLE_COPY(CallRegistry);
+};
+
+LINPHONE_END_NAMESPACE
+
+#endif // ifndef _L_CALL_REGISTRY_H_
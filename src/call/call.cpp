@@ -194,10 +194,6 @@ bool Call::initiateOutgoing(const string &subject, const Content *content) {
 	return defer;
 }
 
-void Call::iterate(time_t currentRealTime, bool oneSecondElapsed) {
-	getActiveSession()->iterate(currentRealTime, oneSecondElapsed);
-}
-
 void Call::notifyRinging() {
 	if (getState() == CallSession::State::IncomingReceived) {
 		getActiveSession()->getPrivate()->handleIncoming(true);
@@ -218,7 +218,6 @@ public:
 	void createPlayer() const;
 	void initiateIncoming();
 	bool initiateOutgoing(const std::string &subject = "", const Content *content = nullptr);
-	void iterate(time_t currentRealTime, bool oneSecondElapsed);
 	void notifyRinging();
 	void startIncomingNotification();
 	void startPushIncomingNotification();
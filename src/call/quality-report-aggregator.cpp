@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2010-2022 Belledonne Communications SARL.
+ *
+ * This file is part of Liblinphone
+ * (see https://gitlab.linphone.org/BC/public/liblinphone).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <fstream>
+
+#include "linphone/api/c-address.h"
+#include "linphone/api/c-event.h"
+
+#include "address/address.h"
+#include "c-wrapper/c-wrapper.h"
+#include "content/content-manager.h"
+#include "core/core.h"
+#include "event/event.h"
+#include "logger/logger.h"
+#include "quality-report-aggregator.h"
+#include "sal/op.h"
+
+#include "private.h"
+
+// =============================================================================
+
+using namespace std;
+
+LINPHONE_BEGIN_NAMESPACE
+
+QualityReportAggregator::QualityReportAggregator(const shared_ptr<Core> &core) : CoreAccessor(core) {
+}
+
+QualityReportAggregator::~QualityReportAggregator() {
+	if (mPendingCount > 0) lWarning() << "QualityReportAggregator: dropping " << mPendingCount << " pending reports";
+	if (mTimer) {
+		// The core is being destroyed, the main loop is going away along with the timer.
+		belle_sip_object_unref(mTimer);
+		mTimer = nullptr;
+	}
+}
+
+int QualityReportAggregator::add(const string &collectorUri, const Content &report) {
+	LinphoneConfig *config = linphone_core_get_config(getCore()->getCCore());
+
+	const string sinkFile =
+	    L_C_TO_STRING(linphone_config_get_string(config, "quality_reporting", "sink_file", nullptr));
+	if (!sinkFile.empty()) return writeToSink(sinkFile, report);
+
+	int maxReports = linphone_config_get_int(config, "quality_reporting", "max_reports_per_publish", 1);
+	if (maxReports <= 1) {
+		Content body(report);
+		return publish(collectorUri, body);
+	}
+
+	auto &reports = mPending[collectorUri];
+	reports.push_back(report);
+	mPendingCount++;
+	if (reports.size() >= (size_t)maxReports) {
+		flush(collectorUri);
+		return 0;
+	}
+
+	if (!mTimer) {
+		int delay = linphone_config_get_int(config, "quality_reporting", "publish_delay_ms", 5000);
+		mTimer = getCore()->getCCore()->sal->createTimer(
+		    [this]() -> bool {
+			    // flush() cancels the timer, so it must not be released before this callback returns.
+			    belle_sip_object_ref(mTimer);
+			    belle_sip_source_t *timer = mTimer;
+			    flush();
+			    belle_sip_object_unref(timer);
+			    return false; // BELLE_SIP_STOP
+		    },
+		    (unsigned int)delay, "quality reports aggregation");
+	}
+	return 0;
+}
+
+void QualityReportAggregator::flush() {
+	stopTimer();
+	while (!mPending.empty())
+		flush(mPending.begin()->first);
+}
+
+void QualityReportAggregator::flush(const string &collectorUri) {
+	auto it = mPending.find(collectorUri);
+	if (it == mPending.end()) return;
+
+	list<Content> reports = std::move(it->second);
+	mPending.erase(it);
+	mPendingCount -= reports.size();
+	if (mPending.empty()) stopTimer();
+
+	if (reports.size() == 1) {
+		publish(collectorUri, reports.front());
+		return;
+	}
+
+	list<Content *> contents;
+	for (auto &report : reports)
+		contents.push_back(&report);
+	Content multipart = ContentManager::contentListToMultipart(contents);
+	lInfo() << "QualityReportAggregator: publishing " << reports.size() << " reports to " << collectorUri;
+	publish(collectorUri, multipart);
+}
+
+int QualityReportAggregator::publish(const string &collectorUri, Content &body) {
+	LinphoneAddress *requestUri = linphone_address_new(collectorUri.c_str());
+	if (!requestUri) {
+		lError() << "QualityReportAggregator: invalid collector URI " << collectorUri;
+		return -1;
+	}
+
+	LinphoneEvent *lev = linphone_core_create_one_shot_publish(getCore()->getCCore(), requestUri, "vq-rtcpxr");
+	/* Special exception for quality report PUBLISH: if the collector_uri has any transport related parameters
+	 * (port, transport, maddr), then it is sent directly.
+	 * Otherwise it is routed as any LinphoneEvent publish, following proxy config policy.
+	 **/
+	const SalAddress *salAddress = Address::toCpp(requestUri)->getImpl();
+	if (sal_address_has_uri_param(salAddress, "transport") || sal_address_has_uri_param(salAddress, "maddr") ||
+	    linphone_address_get_port(requestUri) != 0) {
+		lInfo() << "Publishing report with custom route " << collectorUri;
+		Event::toCpp(lev)->getOp()->setRoute(collectorUri);
+	}
+
+	int ret = linphone_event_send_publish(lev, L_GET_C_BACK_PTR(&body));
+	linphone_address_unref(requestUri);
+	return ret;
+}
+
+int QualityReportAggregator::writeToSink(const string &sinkFile, const Content &report) {
+	ofstream sink(sinkFile, ios::out | ios::app | ios::binary);
+	if (!sink.is_open()) {
+		lError() << "QualityReportAggregator: cannot open report sink " << sinkFile;
+		return -1;
+	}
+	sink << report.getBodyAsUtf8String() << "\r\n";
+	sink.close();
+	return sink.fail() ? -1 : 0;
+}
+
+void QualityReportAggregator::stopTimer() {
+	if (!mTimer) return;
+
+	LinphoneCore *cCore = getCore()->getCCore();
+	if (cCore && cCore->sal) cCore->sal->cancelTimer(mTimer);
+	belle_sip_object_unref(mTimer);
+	mTimer = nullptr;
+}
+
+LINPHONE_END_NAMESPACE
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2010-2022 Belledonne Communications SARL.
+ *
+ * This file is part of Liblinphone
+ * (see https://gitlab.linphone.org/BC/public/liblinphone).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _L_QUALITY_REPORT_AGGREGATOR_H_
+#define _L_QUALITY_REPORT_AGGREGATOR_H_
+
+#include <list>
+#include <map>
+
+#include "content/content.h"
+#include "core/core-accessor.h"
+
+// =============================================================================
+
+typedef struct belle_sip_source belle_sip_source_t;
+
+LINPHONE_BEGIN_NAMESPACE
+
+/*
+ * Delivers the RFC 6035 quality reports of the calls of a core.
+ * By default each report is published as soon as it is made. When [quality_reporting] max_reports_per_publish is
+ * greater than 1, the reports for a collector are gathered and published together in a multipart body, once there are
+ * enough of them or after [quality_reporting] publish_delay_ms. When [quality_reporting] sink_file is set, reports are
+ * appended to this file instead of being published.
+ */
+class QualityReportAggregator : public CoreAccessor {
+public:
+	QualityReportAggregator(const std::shared_ptr<Core> &core);
+	~QualityReportAggregator();
+
+	// Returns 0 when the report was delivered or queued.
+	int add(const std::string &collectorUri, const Content &report);
+	// Publishes every queued report.
+	void flush();
+
+	size_t getPendingCount() const {
+		return mPendingCount;
+	}
+
+private:
+	int publish(const std::string &collectorUri, Content &body);
+	int writeToSink(const std::string &sinkFile, const Content &report);
+	void flush(const std::string &collectorUri);
+
+	void stopTimer();
+
+	std::map<std::string, std::list<Content>> mPending;
+	size_t mPendingCount = 0;
+	belle_sip_source_t *mTimer = nullptr;
+};
+
+LINPHONE_END_NAMESPACE
+
+#endif // ifndef _L_QUALITY_REPORT_AGGREGATOR_H_
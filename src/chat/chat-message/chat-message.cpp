@@ -45,6 +45,7 @@
 #include "content/content-manager.h"
 #include "content/header/header-param.h"
 #include "core/core-p.h"
+#include "core/core-settings.h"
 #include "core/core.h"
 #include "factory/factory.h"
 #include "logger/logger.h"
@@ -160,8 +161,7 @@ void ChatMessagePrivate::setParticipantState(const std::shared_ptr<Address> &par
 	_linphone_chat_message_notify_participant_imdn_state_changed(msg, c_state);
 	_linphone_chat_room_notify_chat_message_participant_imdn_state_changed(cr, msg, c_state);
 
-	if (linphone_config_get_bool(linphone_core_get_config(q->getChatRoom()->getCore()->getCCore()), "misc",
-	                             "enable_simple_group_chat_message_state", FALSE)) {
+	if (q->getChatRoom()->getCore()->getSettings()->misc.enableSimpleGroupChatMessageState) {
 		setState(newState);
 		return;
 	}
@@ -1057,7 +1057,7 @@ void ChatMessagePrivate::send() {
 	shared_ptr<Core> core = q->getCore();
 	const auto toAddr = toAddress->toC();
 	const auto fromAddr = fromAddress->toC();
-	if (linphone_config_get_int(core->getCCore()->config, "sip", "chat_use_call_dialogs", 0) != 0) {
+	if (core->getSettings()->sip.chatUseCallDialogs) {
 		lcall = linphone_core_get_call_by_remote_address2(core->getCCore(), toAddr);
 		if (lcall) {
 			shared_ptr<Call> call = LinphonePrivate::Call::toCpp(lcall)->getSharedFromThis();
@@ -1085,7 +1085,7 @@ void ChatMessagePrivate::send() {
 		/* Sending out of call */
 		salOp = op = new SalMessageOp(core->getCCore()->sal.get());
 		linphone_configure_op_2(core->getCCore(), op, fromAddr, toAddr, getSalCustomHeaders(),
-		                        !!linphone_config_get_int(core->getCCore()->config, "sip", "chat_msg_with_contact", 0));
+		                        core->getSettings()->sip.chatMsgWithContact);
 		op->setUserPointer(q); /* If out of call, directly store msg */
 	}
 	op->setFromAddress(fromAddress->getImpl());
@@ -1653,7 +1653,7 @@ int ChatMessage::putCharacter(uint32_t character) {
 
 	if (character == newLine || character == crlf || character == lf) {
 		shared_ptr<Core> core = getCore();
-		if (linphone_config_get_int(core->getCCore()->config, "misc", "store_rtt_messages", 1) == 1) {
+		if (core->getSettings()->misc.storeRttMessages) {
 			lInfo() << "New line sent, forge a message with content " << d->rttMessage;
 			d->state = State::Displayed;
 			d->setText(d->rttMessage);
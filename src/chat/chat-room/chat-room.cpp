@@ -31,6 +31,7 @@
 #include "chat/chat-room/chat-room-p.h"
 #include "content/content-manager.h"
 #include "core/core-p.h"
+#include "core/core-settings.h"
 #include "linphone/utils/algorithm.h"
 #include "linphone/utils/utils.h"
 #include "logger/logger.h"
@@ -167,7 +168,7 @@ void ChatRoomPrivate::realtimeTextReceived(uint32_t character, const shared_ptr<
 			pendingMessage->getPrivate()->setState(ChatMessage::State::Delivered);
 			pendingMessage->getPrivate()->setTime(::ms_time(0));
 
-			if (linphone_config_get_int(linphone_core_get_config(cCore), "misc", "store_rtt_messages", 1) == 1) {
+			if (core->getSettings()->misc.storeRttMessages) {
 				pendingMessage->getPrivate()->storeInDb();
 			}
 
@@ -390,10 +391,10 @@ void ChatRoomPrivate::onChatMessageReceived(const shared_ptr<ChatMessage> &chatM
 
 	if (chatMessage->getPrivate()->getContentType() == ContentType::ImIsComposing) {
 		onIsComposingReceived(chatMessage->getFromAddress(), chatMessage->getPrivate()->getText());
-		if (linphone_config_get_int(linphone_core_get_config(cCore), "sip", "deliver_imdn", 0) != 1) return;
+		if (!core->getSettings()->sip.deliverImdn) return;
 	} else if (chatMessage->getPrivate()->getContentType() == ContentType::Imdn) {
 		onImdnReceived(chatMessage);
-		if (linphone_config_get_int(linphone_core_get_config(cCore), "sip", "deliver_imdn", 0) != 1) return;
+		if (!core->getSettings()->sip.deliverImdn) return;
 	}
 
 	const std::shared_ptr<Address> &fromAddress = chatMessage->getFromAddress();
@@ -1055,6 +1055,8 @@ void ClientGroupChatRoom::onFirstNotifyReceived(BCTBX_UNUSED(const std::shared_p
 void ClientGroupChatRoom::onFullStateReceived() {
 	L_D();
 
+	notifyParticipantDevicesChanged();
+
 	auto migration = d->needToMigrate();
 	if (migration.first) {
 		BasicToClientGroupChatRoom::migrate(getSharedFromThis(), migration.second);
@@ -1077,6 +1079,7 @@ void ClientGroupChatRoom::onParticipantAdded(const shared_ptr<ConferenceParticip
                                              BCTBX_UNUSED(const std::shared_ptr<Participant> &participant)) {
 	L_D();
 
+	notifyParticipantDevicesChanged();
 	if (event->getFullState()) return;
 
 	d->addEvent(event);
@@ -1089,6 +1092,7 @@ void ClientGroupChatRoom::onParticipantRemoved(const shared_ptr<ConferencePartic
                                                BCTBX_UNUSED(const std::shared_ptr<Participant> &participant)) {
 	L_D();
 
+	notifyParticipantDevicesChanged();
 	d->addEvent(event);
 
 	LinphoneChatRoom *cr = d->getCChatRoom();
@@ -1178,6 +1182,7 @@ void ClientGroupChatRoom::onParticipantDeviceAdded(const shared_ptr<ConferencePa
 
 	auto encryptionEngine = getCore()->getEncryptionEngine();
 	if (encryptionEngine) {
+		encryptionEngine->onParticipantDevicesChanged(getConferenceId());
 		ChatRoom::SecurityLevel currentSecurityLevel = getSecurityLevelExcept(device);
 		securityEvent = encryptionEngine->onDeviceAdded(event->getDeviceAddress(), participant, getSharedFromThis(),
 		                                                currentSecurityLevel);
@@ -1197,6 +1202,7 @@ void ClientGroupChatRoom::onParticipantDeviceRemoved(const shared_ptr<Conference
                                                      BCTBX_UNUSED(const std::shared_ptr<ParticipantDevice> &device)) {
 	L_D();
 
+	notifyParticipantDevicesChanged();
 	d->addEvent(event);
 
 	LinphoneChatRoom *cr = d->getCChatRoom();
@@ -1217,6 +1223,12 @@ void ClientGroupChatRoom::onParticipantsCleared() {
 		getCore()->getPrivate()->mainDb->deleteChatRoomParticipantDevice(getSharedFromThis(), device);
 	}
 	getConference()->clearParticipants();
+	notifyParticipantDevicesChanged();
+}
+
+void ClientGroupChatRoom::notifyParticipantDevicesChanged() {
+	auto encryptionEngine = getCore()->getEncryptionEngine();
+	if (encryptionEngine) encryptionEngine->onParticipantDevicesChanged(getConferenceId());
 }
 
 void ClientGroupChatRoom::onEphemeralModeChanged(const shared_ptr<ConferenceEphemeralMessageEvent> &event) {
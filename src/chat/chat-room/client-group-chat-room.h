@@ -141,6 +141,7 @@ private:
 	void sendInvite(std::shared_ptr<CallSession> &session, const std::list<std::shared_ptr<Address>> &addressList);
 	void setConferenceId(const ConferenceId &conferenceId);
 	void sendEphemeralUpdate();
+	void notifyParticipantDevicesChanged();
 
 	// TODO: Move me in ClientGroupChatRoomPrivate.
 	// ALL METHODS AFTER THIS POINT.
@@ -87,6 +87,11 @@ public:
 		return 0;
 	}
 
+	// Whether downloadingFile() and uploadingFile() may be given the same buffer as input and output.
+	virtual bool isFileProcessingInPlaceSupported() const {
+		return false;
+	}
+
 	virtual int cancelFileTransfer(BCTBX_UNUSED(FileTransferContent *fileTransferContent)) {
 		return 0;
 	}
@@ -111,6 +116,14 @@ public:
 	                            BCTBX_UNUSED(ConferenceSecurityEvent::SecurityEventType securityEventType)) {
 	}
 
+	// Called when participants or devices of a chat room were added or removed.
+	virtual void onParticipantDevicesChanged(BCTBX_UNUSED(const ConferenceId &conferenceId)) {
+	}
+
+	// Called when a chat room was deleted or is no longer known under this conference id.
+	virtual void onChatRoomDeleted(BCTBX_UNUSED(const ConferenceId &conferenceId)) {
+	}
+
 	virtual std::shared_ptr<ConferenceSecurityEvent>
 	onDeviceAdded(BCTBX_UNUSED(const std::shared_ptr<Address> &newDeviceAddr),
 	              BCTBX_UNUSED(std::shared_ptr<Participant> participant),
@@ -199,32 +199,16 @@ ChatMessageModifier::Result LimeX3dhEncryptionEngine::processOutgoingMessage(con
 		}
 	}
 
-	// Add participants to the recipient list
-	bool tooManyDevices = FALSE;
+	// Add participants and potential other devices of the sender participant to the recipient list
 	int maxNbDevicePerParticipant = linphone_config_get_int(linphone_core_get_config(chatRoom->getCore()->getCCore()),
 	                                                        "lime", "max_nb_device_per_participant", INT_MAX);
+	const RecipientsCache &cachedRecipients = getRecipients(chatRoom);
+	bool tooManyDevices = (cachedRecipients.maxNbDevicePerParticipant > maxNbDevicePerParticipant);
 	auto recipients = make_shared<vector<lime::RecipientData>>();
-	const list<shared_ptr<Participant>> participants = chatRoom->getParticipants();
-	for (const shared_ptr<Participant> &participant : participants) {
-		int nbDevice = 0;
-		const list<shared_ptr<ParticipantDevice>> devices = participant->getDevices();
-		for (const shared_ptr<ParticipantDevice> &device : devices) {
-			recipients->emplace_back(device->getAddress()->asStringUriOnly());
-			nbDevice++;
-		}
-		if (nbDevice > maxNbDevicePerParticipant) tooManyDevices = TRUE;
-	}
-
-	// Add potential other devices of the sender participant
-	int nbDevice = 0;
-	const list<shared_ptr<ParticipantDevice>> senderDevices = chatRoom->getMe()->getDevices();
-	for (const auto &senderDevice : senderDevices) {
-		if (*senderDevice->getAddress() != *chatRoom->getLocalAddress()) {
-			recipients->emplace_back(senderDevice->getAddress()->asStringUriOnly());
-			nbDevice++;
-		}
+	recipients->reserve(cachedRecipients.deviceIds.size());
+	for (const auto &deviceId : cachedRecipients.deviceIds) {
+		recipients->emplace_back(deviceId);
 	}
-	if (nbDevice > maxNbDevicePerParticipant) tooManyDevices = TRUE;
 
 	// Check if there is at least one recipient
 	if (recipients->empty()) {
@@ -272,11 +256,14 @@ ChatMessageModifier::Result LimeX3dhEncryptionEngine::processOutgoingMessage(con
 
 	try {
 		errorCode = 0; // no need to specify error code because not used later
+		uint64_t encryptionStartTime = bctbx_get_cur_time_ms();
 		limeManager->encrypt(
 		    localDeviceId, recipientUserId, recipients, plainMessage, cipherMessage,
-		    [localDeviceId, recipients, cipherMessage, message, result](lime::CallbackReturn returnCode,
-		                                                                string errorMessage) {
+		    [localDeviceId, recipients, cipherMessage, message, result,
+		     encryptionStartTime](lime::CallbackReturn returnCode, string errorMessage) {
 			    if (returnCode == lime::CallbackReturn::success) {
+				    lInfo() << "[LIME] message [" << message << "] encrypted for " << recipients->size()
+				            << " devices in " << (bctbx_get_cur_time_ms() - encryptionStartTime) << " ms";
 
 				    // Ignore devices which do not have keys on the X3DH server
 				    // The message will still be sent to them but they will not be able to decrypt it
@@ -608,6 +595,57 @@ int LimeX3dhEncryptionEngine::uploadingFile(BCTBX_UNUSED(const shared_ptr<ChatMe
 	return 0;
 }
 
+const LimeX3dhEncryptionEngine::RecipientsCache &
+LimeX3dhEncryptionEngine::getRecipients(const shared_ptr<AbstractChatRoom> &chatRoom) {
+	const list<shared_ptr<Participant>> participants = chatRoom->getParticipants();
+	const list<shared_ptr<ParticipantDevice>> senderDevices = chatRoom->getMe()->getDevices();
+
+	// Counting devices is cheap compared to building their addresses, it guards against a change that would not
+	// have been notified.
+	size_t nbDevices = senderDevices.size();
+	for (const shared_ptr<Participant> &participant : participants) {
+		nbDevices += participant->getDevices().size();
+	}
+
+	RecipientsCache &cache = recipientsCache[chatRoom->getConferenceId()];
+	if (!cache.deviceIds.empty() && cache.nbDevices == nbDevices) return cache;
+
+	cache.deviceIds.clear();
+	cache.nbDevices = nbDevices;
+	cache.maxNbDevicePerParticipant = 0;
+	for (const shared_ptr<Participant> &participant : participants) {
+		int nbDevice = 0;
+		for (const shared_ptr<ParticipantDevice> &device : participant->getDevices()) {
+			cache.deviceIds.push_back(device->getAddress()->asStringUriOnly());
+			nbDevice++;
+		}
+		cache.maxNbDevicePerParticipant = max(cache.maxNbDevicePerParticipant, nbDevice);
+	}
+
+	int nbDevice = 0;
+	for (const auto &senderDevice : senderDevices) {
+		if (*senderDevice->getAddress() != *chatRoom->getLocalAddress()) {
+			cache.deviceIds.push_back(senderDevice->getAddress()->asStringUriOnly());
+			nbDevice++;
+		}
+	}
+	cache.maxNbDevicePerParticipant = max(cache.maxNbDevicePerParticipant, nbDevice);
+	return cache;
+}
+
+void LimeX3dhEncryptionEngine::onParticipantDevicesChanged(const ConferenceId &conferenceId) {
+	recipientsCache.erase(conferenceId);
+}
+
+void LimeX3dhEncryptionEngine::onChatRoomDeleted(const ConferenceId &conferenceId) {
+	recipientsCache.erase(conferenceId);
+}
+
+bool LimeX3dhEncryptionEngine::isFileProcessingInPlaceSupported() const {
+	// AES-GCM is a stream mode: each output byte only depends on the input byte at the same position.
+	return true;
+}
+
 int LimeX3dhEncryptionEngine::cancelFileTransfer(FileTransferContent *fileTransferContent) {
 	Content *content = static_cast<Content *>(fileTransferContent);
 	// calling decrypt with no data and no buffer to write the tag will simply release the encryption context and delete
@@ -21,6 +21,8 @@
 #ifndef _L_LIME_X3DH_ENCRYPTION_ENGINE_H_
 #define _L_LIME_X3DH_ENCRYPTION_ENGINE_H_
 
+#include <unordered_map>
+
 #include "belle-sip/belle-sip.h"
 #include "belle-sip/http-listener.h"
 #include "carddav.h"
@@ -108,6 +110,8 @@ public:
 	                  uint8_t *encrypted_buffer,
 	                  FileTransferContent *fileTransferContent) override;
 
+	bool isFileProcessingInPlaceSupported() const override;
+
 	int cancelFileTransfer(FileTransferContent *fileTransferContent) override;
 
 	void mutualAuthentication(MSZrtpContext *zrtpContext,
@@ -129,6 +133,9 @@ public:
 	                                                       const std::shared_ptr<AbstractChatRoom> &chatRoom,
 	                                                       ChatRoom::SecurityLevel currentSecurityLevel) override;
 
+	void onParticipantDevicesChanged(const ConferenceId &conferenceId) override;
+	void onChatRoomDeleted(const ConferenceId &conferenceId) override;
+
 	bool isEncryptionEnabledForFileTransfer(const std::shared_ptr<AbstractChatRoom> &ChatRoom) override;
 	AbstractChatRoom::SecurityLevel getSecurityLevel(const std::string &deviceId) const override;
 	AbstractChatRoom::SecurityLevel getSecurityLevel(const std::list<std::string> &deviceIds) const override;
@@ -151,8 +158,18 @@ public:
 	void setTestForceDecryptionFailureFlag(bool flag) override;
 
 private:
+	// Device ids an outgoing message of a chat room is encrypted for, kept until the devices of the chat room change.
+	struct RecipientsCache {
+		std::vector<std::string> deviceIds;
+		size_t nbDevices = 0;
+		int maxNbDevicePerParticipant = 0;
+	};
+
+	const RecipientsCache &getRecipients(const std::shared_ptr<AbstractChatRoom> &chatRoom);
+
 	void update(const std::string localDeviceId);
 	std::shared_ptr<LimeManager> limeManager;
+	std::unordered_map<ConferenceId, RecipientsCache> recipientsCache;
 	std::string _dbAccess;
 	lime::CurveId curve;
 	bool forceFailure = false;
@@ -356,7 +356,7 @@ std::shared_ptr<ConferenceInfo> Ics::Icalendar::toConferenceInfo() const {
 }
 
 shared_ptr<const Ics::Icalendar> Ics::Icalendar::createFromString(const string &str) {
-	return Ics::Parser::getInstance()->parseIcs(bctoolbox::Utils::unfold(str));
+	return Ics::Parser::getInstance()->parseCachedIcs(bctoolbox::Utils::unfold(str));
 }
 
 void Ics::Icalendar::setCreationTime(time_t time) {
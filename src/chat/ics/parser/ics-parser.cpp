@@ -18,6 +18,9 @@
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <functional>
+#include <mutex>
 #include <set>
 
 #include "bctoolbox/utils.hh"
@@ -375,7 +378,19 @@ private:
 
 class Ics::ParserPrivate : public ObjectPrivate {
 public:
+	struct CachedIcalendar {
+		size_t hash;
+		string input;
+		shared_ptr<const Icalendar> icalendar;
+	};
+
+	// An invitation is parsed each time its content is read (reception, notification, import...), so keep the most
+	// recently parsed calendars around. The list is ordered from the most to the least recently used.
+	static constexpr size_t MaxCachedIcalendars = 32;
+
 	shared_ptr<belr::Parser<shared_ptr<Node>>> parser;
+	mutex cacheMutex;
+	list<CachedIcalendar> cachedIcalendars;
 };
 
 Ics::Parser::Parser() : Singleton(*new ParserPrivate) {
@@ -439,4 +454,29 @@ shared_ptr<Ics::Icalendar> Ics::Parser::parseIcs(const string &input) {
 	return icalendar;
 }
 
+shared_ptr<const Ics::Icalendar> Ics::Parser::parseCachedIcs(const string &input) {
+	L_D();
+
+	const size_t hash = std::hash<string>{}(input);
+	{
+		lock_guard<mutex> lock(d->cacheMutex);
+		auto &cache = d->cachedIcalendars;
+		auto it = find_if(cache.begin(), cache.end(),
+		                  [&](const auto &entry) { return (entry.hash == hash) && (entry.input == input); });
+		if (it != cache.end()) {
+			cache.splice(cache.begin(), cache, it);
+			return cache.front().icalendar;
+		}
+	}
+
+	shared_ptr<const Icalendar> icalendar = parseIcs(input);
+	if (!icalendar) return nullptr;
+
+	lock_guard<mutex> lock(d->cacheMutex);
+	auto &cache = d->cachedIcalendars;
+	cache.push_front({hash, input, icalendar});
+	if (cache.size() > ParserPrivate::MaxCachedIcalendars) cache.pop_back();
+	return icalendar;
+}
+
 LINPHONE_END_NAMESPACE
@@ -36,6 +36,8 @@ class LINPHONE_PUBLIC Parser : public Singleton<Parser> {
 
 public:
 	std::shared_ptr<Icalendar> parseIcs(const std::string &input);
+	// Same as parseIcs() but reuses the result of a previous parsing of the same input.
+	std::shared_ptr<const Icalendar> parseCachedIcs(const std::string &input);
 
 private:
 	Parser();
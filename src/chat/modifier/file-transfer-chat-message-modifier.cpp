@@ -32,7 +32,7 @@
 #include "chat/encryption/encryption-engine.h"
 #include "content/content-type.h"
 #include "content/content.h"
-#include "core/core.h"
+#include "core/core-p.h"
 #include "logger/logger.h"
 
 #include "file-transfer-chat-message-modifier.h"
@@ -107,6 +107,9 @@ void FileTransferChatMessageModifier::fileTransferOnProgress(BCTBX_UNUSED(belle_
 	shared_ptr<ChatMessage> message = chatMessage.lock();
 	if (!message) return;
 
+	// When resuming a download, the body handler only knows about the remaining part of the file.
+	offset += resumeOffset;
+	total += resumeOffset;
 	size_t percentage = offset * 100 / total;
 	if (percentage <= lastNotifiedPercentage) {
 		return;
@@ -194,18 +197,17 @@ int FileTransferChatMessageModifier::onSendBody(BCTBX_UNUSED(belle_sip_user_body
 	EncryptionEngine *imee = message->getCore()->getEncryptionEngine();
 	if (imee) {
 		size_t max_size = *size;
-		uint8_t *encrypted_buffer = (uint8_t *)ms_malloc0(max_size);
-		retval = imee->uploadingFile(L_GET_CPP_PTR_FROM_C_OBJECT(msg), offset, buffer, size, encrypted_buffer,
-		                             currentFileTransferContent);
+		bool inPlace = imee->isFileProcessingInPlaceSupported();
+		uint8_t *encrypted_buffer = inPlace ? buffer : getCryptoBuffer(max_size);
+		retval = imee->uploadingFile(message, offset, buffer, size, encrypted_buffer, currentFileTransferContent);
 		if (retval == 0) {
 			if (*size > max_size) {
 				lError() << "IM encryption engine process upload file callback returned a size bigger than the size of "
 				            "the buffer, so it will be truncated !";
 				*size = max_size;
 			}
-			memcpy(buffer, encrypted_buffer, *size);
+			if (!inPlace) memcpy(buffer, encrypted_buffer, *size);
 		}
-		ms_free(encrypted_buffer);
 	}
 
 	return retval <= 0 && *size != 0 ? BELLE_SIP_CONTINUE : BELLE_SIP_STOP;
@@ -292,7 +294,8 @@ FileTransferChatMessageModifier::prepare_upload_body_handler(shared_ptr<ChatMess
 		EncryptionEngine *imee = message->getCore()->getEncryptionEngine();
 		if (imee) {
 			size_t max_size = buf_size;
-			uint8_t *encrypted_buffer = (uint8_t *)ms_malloc0(max_size);
+			bool inPlace = imee->isFileProcessingInPlaceSupported();
+			uint8_t *encrypted_buffer = inPlace ? buf : getCryptoBuffer(max_size);
 			int retval = imee->uploadingFile(message, 0, buf, &max_size, encrypted_buffer, currentFileTransferContent);
 			if (retval == 0) {
 				if (max_size > buf_size) {
@@ -300,11 +303,12 @@ FileTransferChatMessageModifier::prepare_upload_body_handler(shared_ptr<ChatMess
 					            "size of the buffer, so it will be truncated !";
 					max_size = buf_size;
 				}
-				memcpy(buf, encrypted_buffer, buf_size);
+				if (!inPlace) memcpy(buf, encrypted_buffer, buf_size);
 				// Call it once more to compute the authentication tag
 				imee->uploadingFile(message, 0, nullptr, 0, nullptr, currentFileTransferContent);
 			}
-			ms_free(encrypted_buffer);
+			// The whole body has been processed at once, there is no point in keeping a buffer of its size around.
+			std::vector<uint8_t>().swap(cryptoBuffer);
 		}
 
 		first_part_bh = (belle_sip_body_handler_t *)belle_sip_memory_body_handler_new_from_buffer(
@@ -339,11 +343,12 @@ void FileTransferChatMessageModifier::processResponseFromPostFile(const belle_ht
 
 			// Save currentFileContentToTransfer pointer as it will be set to NULL in releaseHttpRequest
 			FileContent *fileContent = currentFileContentToTransfer;
-			releaseHttpRequest();
+			// The transfer slot taken by the empty POST is handed over to the actual upload.
+			releaseHttpRequest(true);
 			currentFileContentToTransfer = fileContent;
 
 			fileUploadBeginBackgroundTask();
-			uploadFile(bh);
+			if (uploadFile(bh) != 0) releaseHttpRequest();
 		} else if (code == 200) { // file has been uploaded correctly, get server reply and send it
 			const char *body = belle_sip_message_get_body((belle_sip_message_t *)event->response);
 			if (body && strlen(body) > 0) {
@@ -553,9 +558,15 @@ int FileTransferChatMessageModifier::startHttpTransfer(const string &url,
 	// keep a reference to the http request to be able to cancel it during upload
 	belle_sip_object_ref(httpRequest);
 
+	if (resumeOffset > 0) {
+		string range = "bytes=" + to_string(resumeOffset) + "-";
+		belle_sip_message_add_header(BELLE_SIP_MESSAGE(httpRequest), belle_http_header_create("Range", range.c_str()));
+	}
+
 	// give msg to listener to be able to start the actual file upload when server answer a 204 No content
 	httpListener = belle_http_request_listener_create_from_callbacks(cbs, this);
-	belle_http_provider_send_request(provider, httpRequest, httpListener);
+	sendHttpRequest(message, action == "GET" ? FileTransferScheduler::Direction::Download
+	                                         : FileTransferScheduler::Direction::Upload);
 	return 0;
 
 error:
@@ -636,16 +647,22 @@ void FileTransferChatMessageModifier::onRecvBody(BCTBX_UNUSED(belle_sip_user_bod
 	int retval = -1;
 	EncryptionEngine *imee = message->getCore()->getEncryptionEngine();
 	if (imee) {
-		uint8_t *decrypted_buffer = (uint8_t *)ms_malloc0(size);
+		bool inPlace = imee->isFileProcessingInPlaceSupported();
+		uint8_t *decrypted_buffer = inPlace ? buffer : getCryptoBuffer(size);
 		retval = imee->downloadingFile(message, offset, buffer, size, decrypted_buffer, currentFileTransferContent);
-		if (retval == 0) {
+		if (retval == 0 && !inPlace) {
 			memcpy(buffer, decrypted_buffer, size);
 		}
-		ms_free(decrypted_buffer);
 	}
 
 	if (retval == 0 || retval == -1) {
-		if (currentFileContentToTransfer->getFilePath().empty()) {
+		if (resumeFile) {
+			if (bctbx_file_write(resumeFile, buffer, size, (off_t)(resumeOffset + offset)) < 0) {
+				lError() << "Unable to write resumed download into [" << currentFileContentToTransfer->getFilePath()
+				         << "]";
+				message->getPrivate()->setState(ChatMessage::State::FileTransferError);
+			}
+		} else if (currentFileContentToTransfer->getFilePath().empty()) {
 			LinphoneChatMessage *msg = L_GET_C_BACK_PTR(message);
 			LinphoneChatMessageCbs *cbs = linphone_chat_message_get_callbacks(msg);
 			LinphoneContent *content = L_GET_C_BACK_PTR((Content *)currentFileContentToTransfer);
@@ -708,6 +725,7 @@ void FileTransferChatMessageModifier::onRecvEnd(BCTBX_UNUSED(belle_sip_user_body
 	if (!message) return;
 
 	shared_ptr<Core> core = message->getCore();
+	closeResumeFile();
 
 	int retval = -1;
 	EncryptionEngine *imee = message->getCore()->getEncryptionEngine();
@@ -810,11 +828,16 @@ void FileTransferChatMessageModifier::processResponseHeadersFromGetFile(const be
 		// if not done, belle-sip will create a memory body handler, the default
 		belle_sip_message_t *response = BELLE_SIP_MESSAGE(event->response);
 
+		if (resumeOffset > 0 && code != 206) {
+			lInfo() << "File server ignored the Range request, downloading the whole file again";
+			resumeOffset = 0;
+		}
+
 		if (currentFileContentToTransfer) {
 			belle_sip_header_content_length_t *content_length_hdr =
 			    BELLE_SIP_HEADER_CONTENT_LENGTH(belle_sip_message_get_header(response, "Content-Length"));
 			currentFileContentToTransfer->setFileSize(
-			    belle_sip_header_content_length_get_content_length(content_length_hdr));
+			    resumeOffset + belle_sip_header_content_length_get_content_length(content_length_hdr));
 			lInfo() << "Extracted content length " << currentFileContentToTransfer->getFileSize() << " from header";
 		} else {
 			lWarning() << "No file transfer information for message [" << message << "]: creating...";
@@ -823,13 +846,26 @@ void FileTransferChatMessageModifier::processResponseHeadersFromGetFile(const be
 		}
 
 		size_t body_size = 0;
-		if (currentFileContentToTransfer) body_size = currentFileContentToTransfer->getFileSize();
+		if (currentFileContentToTransfer) body_size = currentFileContentToTransfer->getFileSize() - resumeOffset;
+
+		if (resumeOffset > 0) {
+			resumeFile =
+			    bctbx_file_open(bctbx_vfs_get_default(), currentFileContentToTransfer->getFilePathSys().c_str(), "r+");
+			if (!resumeFile) {
+				lError() << "Unable to open [" << currentFileContentToTransfer->getFilePath()
+				         << "] to resume its download";
+				onDownloadFailed();
+				return;
+			}
+			lInfo() << "Resuming download of [" << currentFileContentToTransfer->getFilePath() << "] at offset "
+			        << resumeOffset;
+		}
 
 		/* Reception buffering : The decryption engine must get data chunks which size is 0 mod 16
 		 * In order to achieve this, we bufferize the input at body handler level as the callbacks
 		 * cannot modify the size or the offset given by the body handler */
 		belle_sip_body_handler_t *body_handler = NULL;
-		if (!currentFileContentToTransfer->getFilePath().empty()) {
+		if (!currentFileContentToTransfer->getFilePath().empty() && !resumeFile) {
 			/* the buffering is done by file body handler, use a regular user body handler*/
 			belle_sip_user_body_handler_t *bh =
 			    belle_sip_user_body_handler_new(body_size, _chat_message_file_transfer_on_progress, nullptr,
@@ -845,6 +881,7 @@ void FileTransferChatMessageModifier::processResponseHeadersFromGetFile(const be
 			}
 			belle_sip_file_body_handler_set_user_body_handler((belle_sip_file_body_handler_t *)body_handler, bh);
 		} else { // We are not using a file body handler, so we shall bufferize at user body handler level
+			// This is also the case of resumed downloads, as the file body handler would truncate the file.
 			body_handler = (belle_sip_body_handler_t *)belle_sip_buffering_user_body_handler_new(
 			    body_size, 16, _chat_message_file_transfer_on_progress, nullptr, _chat_message_on_recv_body, nullptr,
 			    _chat_message_on_recv_end, this);
@@ -893,6 +930,12 @@ static void _chat_message_process_io_error_download(void *data, const belle_sip_
 void FileTransferChatMessageModifier::processIoErrorDownload(BCTBX_UNUSED(const belle_sip_io_error_event_t *event)) {
 	shared_ptr<ChatMessage> message = chatMessage.lock();
 	lError() << "I/O Error during file download message [" << message << "]";
+	// Encrypted downloads cannot be resumed as the decryption context is not kept.
+	if (currentFileContentToTransfer && !currentFileContentToTransfer->getFilePath().empty() &&
+	    currentFileTransferContent && currentFileTransferContent->getFileKeySize() == 0) {
+		partialDownloadUrl = currentDownloadUrl;
+		partialDownloadPath = currentFileContentToTransfer->getFilePath();
+	}
 	onDownloadFailed();
 }
 
@@ -911,7 +954,7 @@ void FileTransferChatMessageModifier::processResponseFromGetFile(const belle_htt
 		if (code >= 400 && code < 500) {
 			lWarning() << "File transfer failed with code " << code;
 			onDownloadFailed();
-		} else if (code != 200) {
+		} else if (code != 200 && code != 206) {
 			lWarning() << "Unhandled HTTP code response " << code << " for file transfer";
 		}
 	}
@@ -969,6 +1012,10 @@ bool FileTransferChatMessageModifier::downloadFile(const shared_ptr<ChatMessage>
 	std::string url =
 	    fileTransferContent
 	        ->getFileUrl(); // File URL has been set by createFileTransferInformationsFromVndGsmaRcsFtHttpXml
+	currentDownloadUrl = url;
+	resumeOffset = getResumableDownloadOffset(url);
+	partialDownloadUrl.clear();
+	partialDownloadPath.clear();
 	// Shall we use a proxy to get this file?
 	std::string proxy(linphone_config_get_string(message->getCore()->getCCore()->config, "misc",
 	                                             "file_transfer_server_get_proxy", ""));
@@ -1029,7 +1076,7 @@ bool FileTransferChatMessageModifier::isFileTransferInProgressAndValid() const {
 	return httpRequest && !belle_http_request_is_cancelled(httpRequest);
 }
 
-void FileTransferChatMessageModifier::releaseHttpRequest() {
+void FileTransferChatMessageModifier::releaseHttpRequest(bool keepTransferSlot) {
 	if (httpRequest) {
 		belle_sip_object_unref(httpRequest);
 		httpRequest = nullptr;
@@ -1039,6 +1086,60 @@ void FileTransferChatMessageModifier::releaseHttpRequest() {
 		}
 	}
 	currentFileContentToTransfer = nullptr;
+	std::vector<uint8_t>().swap(cryptoBuffer);
+	closeResumeFile();
+	resumeOffset = 0;
+
+	if (keepTransferSlot) return;
+	auto fileTransferScheduler = scheduler.lock();
+	if (fileTransferScheduler) fileTransferScheduler->release(this);
+	scheduler.reset();
+}
+
+void FileTransferChatMessageModifier::sendHttpRequest(const shared_ptr<ChatMessage> &message,
+                                                      FileTransferScheduler::Direction direction) {
+	auto fileTransferScheduler = message->getCore()->getPrivate()->fileTransferScheduler;
+	// A slot that is still held was kept by releaseHttpRequest() for this request.
+	if (!fileTransferScheduler || !scheduler.expired()) {
+		belle_http_provider_send_request(provider, httpRequest, httpListener);
+		return;
+	}
+
+	// Automatic downloads must not delay the transfers the user is waiting for.
+	FileTransferScheduler::Priority priority = message->getPrivate()->isAutoFileTransferDownloadInProgress()
+	                                               ? FileTransferScheduler::Priority::Low
+	                                               : FileTransferScheduler::Priority::Normal;
+	scheduler = fileTransferScheduler;
+	fileTransferScheduler->submit(this, direction, priority, [this]() {
+		if (httpRequest && !belle_http_request_is_cancelled(httpRequest))
+			belle_http_provider_send_request(provider, httpRequest, httpListener);
+	});
+}
+
+size_t FileTransferChatMessageModifier::getResumableDownloadOffset(const string &url) const {
+	if (url != partialDownloadUrl || currentFileContentToTransfer->getFilePath() != partialDownloadPath) return 0;
+	if (currentFileTransferContent->getFileKeySize() > 0) return 0;
+
+	bctbx_vfs_file_t *file =
+	    bctbx_file_open(bctbx_vfs_get_default(), currentFileContentToTransfer->getFilePathSys().c_str(), "r");
+	if (!file) return 0;
+	int64_t size = bctbx_file_size(file);
+	bctbx_file_close(file);
+
+	if (size <= 0 || (size_t)size >= currentFileTransferContent->getFileSize()) return 0;
+	return (size_t)size;
+}
+
+void FileTransferChatMessageModifier::closeResumeFile() {
+	if (resumeFile) {
+		bctbx_file_close(resumeFile);
+		resumeFile = nullptr;
+	}
+}
+
+uint8_t *FileTransferChatMessageModifier::getCryptoBuffer(size_t size) {
+	if (cryptoBuffer.size() < size) cryptoBuffer.resize(size);
+	return cryptoBuffer.data();
 }
 
 /* -------------------------------------------------------------------------------------- */
@@ -21,9 +21,13 @@
 #ifndef _L_FILE_TRANSFER_CHAT_MESSAGE_MODIFIER_H_
 #define _L_FILE_TRANSFER_CHAT_MESSAGE_MODIFIER_H_
 
+#include <vector>
+
+#include <bctoolbox/vfs.h>
 #include <belle-sip/belle-sip.h>
 
 #include "chat-message-modifier.h"
+#include "file-transfer-scheduler.h"
 #include "utils/background-task.h"
 
 // =============================================================================
@@ -88,9 +92,14 @@ private:
 	void fileUploadBeginBackgroundTask();
 
 	void onDownloadFailed();
-	void releaseHttpRequest();
+	// Unless keepTransferSlot is set, the slot of the transfer scheduler is released as well.
+	void releaseHttpRequest(bool keepTransferSlot = false);
 	belle_sip_body_handler_t *prepare_upload_body_handler(std::shared_ptr<ChatMessage> message);
 
+	void sendHttpRequest(const std::shared_ptr<ChatMessage> &message, FileTransferScheduler::Direction direction);
+	uint8_t *getCryptoBuffer(size_t size);
+	size_t getResumableDownloadOffset(const std::string &url) const;
+	void closeResumeFile();
 	std::string escapeFileName(const std::string &fileName) const;
 	std::string unEscapeFileName(const std::string &fileName) const;
 
@@ -104,6 +113,19 @@ private:
 
 	size_t lastNotifiedPercentage = 0;
 
+	// Reused for every chunk of the current transfer when the encryption engine cannot work in place.
+	std::vector<uint8_t> cryptoBuffer;
+
+	// Location of the file left incomplete by the last download I/O error, so that downloading it again resumes
+	// from where it stopped.
+	std::string partialDownloadUrl;
+	std::string partialDownloadPath;
+	std::string currentDownloadUrl;
+	size_t resumeOffset = 0;
+	bctbx_vfs_file_t *resumeFile = nullptr;
+
+	std::weak_ptr<FileTransferScheduler> scheduler;
+
 	BackgroundTask bgTask;
 };
 
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2010-2022 Belledonne Communications SARL.
+ *
+ * This file is part of Liblinphone
+ * (see https://gitlab.linphone.org/BC/public/liblinphone).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+
+#include "file-transfer-scheduler.h"
+#include "logger/logger.h"
+
+// =============================================================================
+
+using namespace std;
+
+LINPHONE_BEGIN_NAMESPACE
+
+FileTransferScheduler::FileTransferScheduler(unsigned int maxUploads, unsigned int maxDownloads)
+    : maxUploads(maxUploads), maxDownloads(maxDownloads) {
+}
+
+void FileTransferScheduler::submit(const void *owner,
+                                   Direction direction,
+                                   Priority priority,
+                                   const function<void()> &start) {
+	release(owner);
+
+	if (hasFreeSlot(direction)) {
+		running.emplace_back(owner, direction);
+		start();
+		return;
+	}
+
+	// Keep the queue sorted by priority, transfers of the same priority are started in submission order.
+	auto it = find_if(queued.begin(), queued.end(), [priority](const Transfer &transfer) {
+		return transfer.priority > priority;
+	});
+	queued.insert(it, Transfer{owner, direction, priority, start});
+	lInfo() << "File transfer [" << owner << "] queued, " << getRunningCount(direction) << " "
+	        << (direction == Direction::Upload ? "uploads" : "downloads") << " already running";
+}
+
+void FileTransferScheduler::release(const void *owner) {
+	auto it = find_if(running.begin(), running.end(),
+	                  [owner](const pair<const void *, Direction> &transfer) { return transfer.first == owner; });
+	if (it != running.end()) {
+		Direction direction = it->second;
+		running.erase(it);
+		startQueued(direction);
+		return;
+	}
+
+	queued.remove_if([owner](const Transfer &transfer) { return transfer.owner == owner; });
+}
+
+size_t FileTransferScheduler::getRunningCount(Direction direction) const {
+	return (size_t)count_if(running.cbegin(), running.cend(),
+	                        [direction](const pair<const void *, Direction> &transfer) {
+		                        return transfer.second == direction;
+	                        });
+}
+
+size_t FileTransferScheduler::getQueuedCount(Direction direction) const {
+	return (size_t)count_if(queued.cbegin(), queued.cend(),
+	                        [direction](const Transfer &transfer) { return transfer.direction == direction; });
+}
+
+bool FileTransferScheduler::hasFreeSlot(Direction direction) const {
+	unsigned int max = (direction == Direction::Upload) ? maxUploads : maxDownloads;
+	return (max == 0) || (getRunningCount(direction) < max);
+}
+
+void FileTransferScheduler::startQueued(Direction direction) {
+	while (hasFreeSlot(direction)) {
+		auto it = find_if(queued.begin(), queued.end(),
+		                  [direction](const Transfer &transfer) { return transfer.direction == direction; });
+		if (it == queued.end()) return;
+
+		// The transfer is removed from the queue before being started as starting it may release it again.
+		Transfer transfer = *it;
+		queued.erase(it);
+		running.emplace_back(transfer.owner, transfer.direction);
+		transfer.start();
+	}
+}
+
+LINPHONE_END_NAMESPACE
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2010-2022 Belledonne Communications SARL.
+ *
+ * This file is part of Liblinphone
+ * (see https://gitlab.linphone.org/BC/public/liblinphone).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _L_FILE_TRANSFER_SCHEDULER_H_
+#define _L_FILE_TRANSFER_SCHEDULER_H_
+
+#include <functional>
+#include <list>
+
+#include "linphone/utils/general.h"
+
+// =============================================================================
+
+LINPHONE_BEGIN_NAMESPACE
+
+/*
+ * Bounds the number of HTTP file transfers running at the same time in a core.
+ * Transfers above the limit are queued and started by priority, then in submission order, when a running transfer
+ * of the same direction is released.
+ */
+class LINPHONE_PUBLIC FileTransferScheduler {
+public:
+	enum class Direction { Upload, Download };
+	enum class Priority { Normal, Low };
+
+	// A limit of 0 means that transfers are never queued.
+	FileTransferScheduler(unsigned int maxUploads, unsigned int maxDownloads);
+
+	// Calls start immediately if a slot is available, later otherwise. An owner has at most one transfer.
+	void submit(const void *owner, Direction direction, Priority priority, const std::function<void()> &start);
+	// Frees the slot of the owner, or forgets its transfer if it was still queued.
+	void release(const void *owner);
+
+	size_t getRunningCount(Direction direction) const;
+	size_t getQueuedCount(Direction direction) const;
+
+private:
+	struct Transfer {
+		const void *owner;
+		Direction direction;
+		Priority priority;
+		std::function<void()> start;
+	};
+
+	bool hasFreeSlot(Direction direction) const;
+	void startQueued(Direction direction);
+
+	std::list<std::pair<const void *, Direction>> running;
+	std::list<Transfer> queued;
+	unsigned int maxUploads;
+	unsigned int maxDownloads;
+};
+
+LINPHONE_END_NAMESPACE
+
+#endif // ifndef _L_FILE_TRANSFER_SCHEDULER_H_
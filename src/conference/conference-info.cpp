@@ -48,6 +48,7 @@ const std::shared_ptr<Address> &ConferenceInfo::getOrganizerAddress() const {
 
 void ConferenceInfo::setOrganizer(const std::shared_ptr<Address> &organizer, const participant_params_t &params) {
 	mOrganizer = std::make_pair(Address::create(organizer->getUri()), params);
+	mIcsCache.clear();
 }
 
 void ConferenceInfo::setOrganizer(const std::shared_ptr<Address> &organizer) {
@@ -57,6 +58,7 @@ void ConferenceInfo::setOrganizer(const std::shared_ptr<Address> &organizer) {
 
 void ConferenceInfo::addOrganizerParam(const std::string &param, const std::string &value) {
 	mOrganizer.second[param] = value;
+	mIcsCache.clear();
 }
 
 const std::string ConferenceInfo::getOrganizerParam(const std::string &param) const {
@@ -85,6 +87,7 @@ void ConferenceInfo::addParticipant(const std::shared_ptr<Address> &participant)
 
 void ConferenceInfo::addParticipant(const std::shared_ptr<Address> &participant, const participant_params_t &params) {
 	mParticipants.insert(std::make_pair(Address::create(participant->getUri()), params));
+	mIcsCache.clear();
 }
 
 void ConferenceInfo::removeParticipant(const std::shared_ptr<Address> &participant) {
@@ -95,6 +98,7 @@ void ConferenceInfo::removeParticipant(const std::shared_ptr<Address> &participa
 		        << " (address " << *getUri() << ")";
 	} else {
 		mParticipants.erase(it);
+		mIcsCache.clear();
 	}
 }
 
@@ -106,6 +110,7 @@ void ConferenceInfo::addParticipantParam(const std::shared_ptr<Address> &partici
 	if (it != mParticipants.end()) {
 		auto &params = (*it).second;
 		params[param] = value;
+		mIcsCache.clear();
 	}
 }
 
@@ -133,6 +138,7 @@ const std::shared_ptr<Address> &ConferenceInfo::getUri() const {
 
 void ConferenceInfo::setUri(const std::shared_ptr<Address> uri) {
 	mUri = Address::create(uri->getUri());
+	mIcsCache.clear();
 }
 
 time_t ConferenceInfo::getDateTime() const {
@@ -141,6 +147,7 @@ time_t ConferenceInfo::getDateTime() const {
 
 void ConferenceInfo::setDateTime(time_t dateTime) {
 	mDateTime = dateTime;
+	mIcsCache.clear();
 }
 
 unsigned int ConferenceInfo::getDuration() const {
@@ -149,6 +156,7 @@ unsigned int ConferenceInfo::getDuration() const {
 
 void ConferenceInfo::setDuration(unsigned int duration) {
 	mDuration = duration;
+	mIcsCache.clear();
 }
 
 const std::string &ConferenceInfo::getSubject() const {
@@ -161,10 +169,12 @@ const std::string ConferenceInfo::getUtf8Subject() const {
 
 void ConferenceInfo::setSubject(const std::string &subject) {
 	mSubject = Utils::trim(subject);
+	mIcsCache.clear();
 }
 
 void ConferenceInfo::setUtf8Subject(const std::string &subject) {
 	mSubject = Utils::trim(Utils::utf8ToLocale(subject));
+	mIcsCache.clear();
 }
 
 unsigned int ConferenceInfo::getIcsSequence() const {
@@ -173,6 +183,7 @@ unsigned int ConferenceInfo::getIcsSequence() const {
 
 void ConferenceInfo::setIcsSequence(unsigned int icsSequence) {
 	mIcsSequence = icsSequence;
+	mIcsCache.clear();
 }
 
 const std::string ConferenceInfo::getUtf8IcsUid() const {
@@ -185,10 +196,12 @@ const std::string &ConferenceInfo::getIcsUid() const {
 
 void ConferenceInfo::setUtf8IcsUid(const std::string &uid) {
 	mIcsUid = Utils::trim(Utils::utf8ToLocale(uid));
+	mIcsCache.clear();
 }
 
 void ConferenceInfo::setIcsUid(const std::string &uid) {
 	mIcsUid = Utils::trim(uid);
+	mIcsCache.clear();
 }
 
 const string ConferenceInfo::getUtf8Description() const {
@@ -201,10 +214,12 @@ const string &ConferenceInfo::getDescription() const {
 
 void ConferenceInfo::setDescription(const string &description) {
 	mDescription = Utils::trim(description);
+	mIcsCache.clear();
 }
 
 void ConferenceInfo::setUtf8Description(const string &description) {
 	mDescription = Utils::trim(Utils::utf8ToLocale(description));
+	mIcsCache.clear();
 }
 
 const ConferenceInfo::State &ConferenceInfo::getState() const {
@@ -215,6 +230,7 @@ void ConferenceInfo::setState(const ConferenceInfo::State &state) {
 	if (mState != state) {
 		lInfo() << "[Conference Info] [" << this << "] moving from state " << mState << " to state " << state;
 		mState = state;
+		mIcsCache.clear();
 	}
 }
 
@@ -232,6 +248,7 @@ void ConferenceInfo::updateFrom(const std::shared_ptr<ConferenceInfo> &info) {
 
 		if (otherParticipant != participants.cend()) {
 			participant.second = otherParticipant->second;
+			mIcsCache.clear();
 		}
 	}
 }
@@ -242,6 +259,10 @@ void ConferenceInfo::updateFrom(const std::shared_ptr<ConferenceInfo> &info) {
 #endif // _MSC_VER
 const string ConferenceInfo::toIcsString(bool cancel, int sequence) const {
 #ifdef HAVE_ADVANCED_IM
+	const auto cacheKey = std::make_pair(cancel, sequence);
+	const auto cached = mIcsCache.find(cacheKey);
+	if (cached != mIcsCache.cend()) return cached->second;
+
 	Ics::Icalendar cal;
 
 	Ics::Icalendar::Method method = Ics::Icalendar::Method::Request;
@@ -310,6 +331,7 @@ const string ConferenceInfo::toIcsString(bool cancel, int sequence) const {
 		mIcsSequence = event->getSequence();
 	}
 
+	mIcsCache[cacheKey] = icsString;
 	return icsString;
 #else
 	lWarning() << "No ICS support, ADVANCED_IM is disabled.";
@@ -322,6 +344,7 @@ const string ConferenceInfo::toIcsString(bool cancel, int sequence) const {
 
 void ConferenceInfo::setCreationTime(time_t time) {
 	mCreationTime = time;
+	mIcsCache.clear();
 }
 
 const std::string ConferenceInfo::memberParametersToString(const ConferenceInfo::participant_params_t &params) {
@@ -161,6 +161,10 @@ private:
 	mutable std::string mIcsUid = "";
 	State mState = State::New;
 	time_t mCreationTime = (time_t)-1;
+
+	// Generated ICS keyed by (cancel, sequence). It is cleared by every setter so that an invitation sent to many
+	// participants is only serialized once per revision of the conference information.
+	mutable std::map<std::pair<bool, int>, std::string> mIcsCache;
 };
 
 std::ostream &operator<<(std::ostream &lhs, ConferenceInfo::State s);
@@ -304,11 +304,25 @@ void ConferenceScheduler::onChatMessageStateChanged(const shared_ptr<ChatMessage
 		return;
 	}
 
+	onInvitationProcessed();
+}
+
+void ConferenceScheduler::onInvitationProcessed() {
+	if (mInvitationsInFlight > 0) mInvitationsInFlight--;
+	mInvitationsProcessed++;
+	linphone_conference_scheduler_notify_invitations_progress(toC(), (unsigned int)mInvitationsProcessed,
+	                                                          (unsigned int)mInvitationsCount);
+
 	if (mInvitationsSent + mInvitationsInError.size() == mInvitationsToSend.size()) {
+		lInfo() << "[Conference Scheduler] [" << this << "] " << mInvitationsProcessed << " invitations processed in "
+		        << (bctbx_get_cur_time_ms() - mInvitationsStartTime) << " ms, " << mInvitationsInError.size()
+		        << " failed";
 		ListHolder<Address> erroredInvitations;
 		erroredInvitations.mList = mInvitationsInError;
 		linphone_conference_scheduler_notify_invitations_sent(toC(), erroredInvitations.getCList());
 	}
+
+	sendNextInvitations();
 }
 
 void ConferenceScheduler::setConferenceAddress(const std::shared_ptr<Address> &conferenceAddress) {
@@ -430,15 +444,55 @@ shared_ptr<ChatMessage> ConferenceScheduler::createInvitationChatMessage(shared_
 		message = chatRoom->createFileTransferMessage(content);
 	}
 
-	// Update conference info in database with new sequence and uid
-#ifdef HAVE_DB_STORAGE
-	auto &mainDb = getCore()->getPrivate()->mainDb;
-	mainDb->insertConferenceInfo(mConferenceInfo);
-#endif // HAVE_DB_STORAGE
 	message->addListener(getSharedFromThis());
 	return message;
 }
 
+void ConferenceScheduler::sendNextInvitations() {
+	// Sending a message may report its failure right away, the loop below then goes on with the next invitations.
+	if (mSendingInvitations) return;
+	mSendingInvitations = true;
+
+	const int maxInFlight = linphone_config_get_int(linphone_core_get_config(getCore()->getCCore()), "misc",
+	                                                "conference_invitations_max_in_flight", 10);
+	while (!mPendingInvitations.empty() && (maxInFlight <= 0 || mInvitationsInFlight < (size_t)maxInFlight)) {
+		const auto participant = mPendingInvitations.front().first;
+		auto chatRoom = mPendingInvitations.front().second;
+		mPendingInvitations.pop_front();
+		mInvitationsInFlight++;
+
+		if (!chatRoom) {
+			lInfo() << "[Conference Scheduler] [" << this << "] Existing chat room between [" << *mInvitationsSender
+			        << "] and [" << *participant << "] wasn't found, creating it.";
+			list<std::shared_ptr<Address>> participantList;
+			participantList.push_back(participant);
+			chatRoom = getCore()->getPrivate()->createChatRoom(mInvitationsChatRoomParams, mInvitationsSender,
+			                                                   participantList);
+		} else {
+			lInfo() << "[Conference Scheduler] [" << this << "] Found existing chat room ["
+			        << *chatRoom->getPeerAddress() << "] between [" << *mInvitationsSender << "] and [" << *participant
+			        << "], using it";
+		}
+
+		if (!chatRoom) {
+			lError() << "[Conference Scheduler] [" << this << "] Couldn't find nor create a chat room between ["
+			         << *mInvitationsSender << "] and [" << *participant << "]";
+			mInvitationsInError.push_back(participant);
+			onInvitationProcessed();
+			continue;
+		}
+
+		const bool cancel = (mCancelToSend.find(participant) != mCancelToSend.cend()) ||
+		                    (mConferenceInfo->getState() == ConferenceInfo::State::Cancelled);
+
+		shared_ptr<ChatMessage> message = createInvitationChatMessage(chatRoom, participant, cancel);
+		message->getPrivate()->setRecipientAddress(participant);
+		message->send();
+	}
+
+	mSendingInvitations = false;
+}
+
 void ConferenceScheduler::sendInvitations(shared_ptr<ChatRoomParams> chatRoomParams) {
 	if (mState != State::Ready) {
 		lWarning() << "[Conference Scheduler] [" << this
@@ -527,37 +581,30 @@ void ConferenceScheduler::sendInvitations(shared_ptr<ChatRoomParams> chatRoomPar
 	mInvitationsInError.clear();
 	mInvitationsSent = 0;
 
-	// Sending the ICS once for each participant in a separated chat room each time.
-	for (auto participant : invitees) {
-		list<std::shared_ptr<Address>> participantList;
-		participantList.push_back(participant);
-		shared_ptr<AbstractChatRoom> chatRoom =
-		    getCore()->getPrivate()->searchChatRoom(chatRoomParams, sender, nullptr, participantList);
-
-		if (!chatRoom) {
-			lInfo() << "[Conference Scheduler] [" << this << "] Existing chat room between [" << *sender << "] and ["
-			        << *participant << "] wasn't found, creating it.";
-			chatRoom = getCore()->getPrivate()->createChatRoom(chatRoomParams, sender, participantList);
-		} else {
-			lInfo() << "[Conference Scheduler] [" << this << "] Found existing chat room ["
-			        << *chatRoom->getPeerAddress() << "] between [" << *sender << "] and [" << *participant
-			        << "], using it";
-		}
-
-		if (!chatRoom) {
-			lError() << "[Conference Scheduler] [" << this << "] Couldn't find nor create a chat room between ["
-			         << *sender << "] and [" << *participant << "]";
-			mInvitationsInError.push_back(participant);
-			continue;
-		}
-
-		const bool cancel = (mCancelToSend.find(participant) != mCancelToSend.cend()) ||
-		                    (mConferenceInfo->getState() == ConferenceInfo::State::Cancelled);
-
-		shared_ptr<ChatMessage> message = createInvitationChatMessage(chatRoom, participant, cancel);
-		message->getPrivate()->setRecipientAddress(participant);
-		message->send();
+	// Update conference info in database with new sequences and uid, once for all the invitations.
+#ifdef HAVE_DB_STORAGE
+	if (!invitees.empty()) {
+		auto &mainDb = getCore()->getPrivate()->mainDb;
+		mainDb->insertConferenceInfo(mConferenceInfo);
 	}
+#endif // HAVE_DB_STORAGE
+
+	// Sending the ICS once for each participant but ourselves in a separated chat room each time.
+	// The existing chat rooms are all looked up at once, then the invitations are sent with a bounded number of them
+	// in flight so that creating the missing chat rooms does not stall the core for large conferences.
+	const auto chatRooms = getCore()->getPrivate()->searchOneToOneChatRooms(chatRoomParams, sender, mInvitationsToSend);
+	mPendingInvitations.clear();
+	auto chatRoomIt = chatRooms.cbegin();
+	for (const auto &participant : mInvitationsToSend) {
+		mPendingInvitations.emplace_back(participant, *chatRoomIt++);
+	}
+	mInvitationsChatRoomParams = chatRoomParams;
+	mInvitationsSender = sender;
+	mInvitationsInFlight = 0;
+	mInvitationsProcessed = 0;
+	mInvitationsCount = mPendingInvitations.size();
+	mInvitationsStartTime = bctbx_get_cur_time_ms();
+	sendNextInvitations();
 }
 
 string ConferenceScheduler::stateToString(ConferenceScheduler::State state) {
@@ -608,4 +655,12 @@ void ConferenceSchedulerCbs::setInvitationsSent(LinphoneConferenceSchedulerCbsIn
 	mInvitationsSent = cb;
 }
 
+LinphoneConferenceSchedulerCbsInvitationsProgressCb ConferenceSchedulerCbs::getInvitationsProgress() const {
+	return mInvitationsProgress;
+}
+
+void ConferenceSchedulerCbs::setInvitationsProgress(LinphoneConferenceSchedulerCbsInvitationsProgressCb cb) {
+	mInvitationsProgress = cb;
+}
+
 LINPHONE_END_NAMESPACE
@@ -83,6 +83,8 @@ private:
 	std::shared_ptr<ChatMessage> createInvitationChatMessage(std::shared_ptr<AbstractChatRoom> chatRoom,
 	                                                         const std::shared_ptr<Address> participant,
 	                                                         bool cancel);
+	void sendNextInvitations();
+	void onInvitationProcessed();
 	void fillCancelList(const ConferenceInfo::participant_list_t &oldList,
 	                    const ConferenceInfo::participant_list_t &newList);
 
@@ -95,6 +97,16 @@ private:
 	std::list<std::shared_ptr<Address>> mInvitationsToSend;
 	std::map<std::shared_ptr<Address>, int> mCancelToSend;
 	std::list<std::shared_ptr<Address>> mInvitationsInError;
+
+	// Invitations waiting for a slot, with the chat room found for the invitee if any.
+	std::list<std::pair<std::shared_ptr<Address>, std::shared_ptr<AbstractChatRoom>>> mPendingInvitations;
+	std::shared_ptr<ChatRoomParams> mInvitationsChatRoomParams = nullptr;
+	std::shared_ptr<const Address> mInvitationsSender = nullptr;
+	size_t mInvitationsInFlight = 0;
+	size_t mInvitationsProcessed = 0;
+	size_t mInvitationsCount = 0;
+	uint64_t mInvitationsStartTime = 0;
+	bool mSendingInvitations = false;
 };
 
 class ConferenceSchedulerCbs : public bellesip::HybridObject<LinphoneConferenceSchedulerCbs, ConferenceSchedulerCbs>,
@@ -104,10 +116,13 @@ public:
 	void setStateChanged(LinphoneConferenceSchedulerCbsStateChangedCb cb);
 	LinphoneConferenceSchedulerCbsInvitationsSentCb getInvitationsSent() const;
 	void setInvitationsSent(LinphoneConferenceSchedulerCbsInvitationsSentCb cb);
+	LinphoneConferenceSchedulerCbsInvitationsProgressCb getInvitationsProgress() const;
+	void setInvitationsProgress(LinphoneConferenceSchedulerCbsInvitationsProgressCb cb);
 
 private:
 	LinphoneConferenceSchedulerCbsStateChangedCb mStateChangedCb = nullptr;
 	LinphoneConferenceSchedulerCbsInvitationsSentCb mInvitationsSent = nullptr;
+	LinphoneConferenceSchedulerCbsInvitationsProgressCb mInvitationsProgress = nullptr;
 };
 
 std::ostream &operator<<(std::ostream &lhs, ConferenceScheduler::State s);
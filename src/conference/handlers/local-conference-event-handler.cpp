@@ -66,6 +66,7 @@ void LocalConferenceEventHandler::notifyFullState(const Content &notify, const s
 
 void LocalConferenceEventHandler::notifyAllExceptDevice(const Content &notify,
                                                         const shared_ptr<ParticipantDevice> &exceptDevice) {
+	invalidateFullStateCache();
 	for (const auto &participant : conf->getParticipants()) {
 		for (const auto &device : participant->getDevices()) {
 			if (device != exceptDevice) {
@@ -78,6 +79,7 @@ void LocalConferenceEventHandler::notifyAllExceptDevice(const Content &notify,
 
 void LocalConferenceEventHandler::notifyAllExcept(const Content &notify,
                                                   const shared_ptr<Participant> &exceptParticipant) {
+	invalidateFullStateCache();
 	for (const auto &participant : conf->getParticipants()) {
 		if (participant != exceptParticipant) {
 			notifyParticipant(notify, participant);
@@ -86,12 +88,17 @@ void LocalConferenceEventHandler::notifyAllExcept(const Content &notify,
 }
 
 void LocalConferenceEventHandler::notifyAll(const Content &notify) {
+	invalidateFullStateCache();
 	for (const auto &participant : conf->getParticipants()) {
 		notifyParticipant(notify, participant);
 	}
 }
 
-Content LocalConferenceEventHandler::createNotifyFullState(const shared_ptr<EventSubscribe> &ev) {
+void LocalConferenceEventHandler::invalidateFullStateCache() {
+	fullStateCache = Content();
+}
+
+Content LocalConferenceEventHandler::createNotifyFullState(const shared_ptr<EventSubscribe> &ev, bool deflate) {
 	vector<string> acceptedContents = vector<string>();
 	if (ev) {
 		const auto message = (belle_sip_message_t *)ev->getOp()->getRecvCustomHeaders();
@@ -218,7 +225,7 @@ Content LocalConferenceEventHandler::createNotifyFullState(const shared_ptr<Even
 
 		confInfo.getUsers()->getUser().push_back(user);
 	}
-	return makeContent(createNotify(confInfo, true));
+	return makeContent(createNotify(confInfo, true), deflate);
 }
 
 void LocalConferenceEventHandler::addAvailableMediaCapabilities(const LinphoneMediaDirection audioDirection,
@@ -380,7 +387,7 @@ void LocalConferenceEventHandler::addMediaCapabilities(const std::shared_ptr<Par
 	endpoint.getMedia().push_back(text);
 }
 
-Content LocalConferenceEventHandler::createNotifyMultipart(int notifyId) {
+Content LocalConferenceEventHandler::createNotifyMultipart(int notifyId, bool deflate) {
 	list<shared_ptr<EventLog>> events = conf->getCore()->getPrivate()->mainDb->getConferenceNotifiedEvents(
 	    ConferenceId(conf->getConferenceAddress(), conf->getConferenceAddress()), static_cast<unsigned int>(notifyId));
 
@@ -471,7 +478,7 @@ Content LocalConferenceEventHandler::createNotifyMultipart(int notifyId) {
 				L_ASSERT(false);
 				continue;
 		}
-		contents.emplace_back(makeContent(body));
+		contents.emplace_back(makeContent(body, deflate));
 	}
 
 	if (contents.empty()) return Content();
@@ -480,7 +487,7 @@ Content LocalConferenceEventHandler::createNotifyMultipart(int notifyId) {
 	for (auto &content : contents)
 		contentPtrs.push_back(&content);
 	Content multipart = ContentManager::contentListToMultipart(contentPtrs);
-	if (linphone_core_content_encoding_supported(conf->getCore()->getCCore(), "deflate"))
+	if (deflate && linphone_core_content_encoding_supported(conf->getCore()->getCCore(), "deflate"))
 		multipart.setContentEncoding("deflate");
 	return multipart;
 }
@@ -1061,25 +1068,34 @@ void LocalConferenceEventHandler::subscriptionStateChanged(const shared_ptr<Even
 	}
 }
 
-Content LocalConferenceEventHandler::getNotifyForId(int notifyId, const shared_ptr<EventSubscribe> &ev) {
+Content LocalConferenceEventHandler::getNotifyForId(int notifyId,
+                                                    const shared_ptr<EventSubscribe> &ev,
+                                                    bool deflateParts) {
 	unsigned int lastNotify = conf->getLastNotify();
 	if ((notifyId == 0) || (notifyId > static_cast<int>(lastNotify))) {
-		auto content = createNotifyFullState(ev);
-		list<Content *> contentPtrs;
-		contentPtrs.push_back(&content);
-		auto multipart = ContentManager::contentListToMultipart(contentPtrs);
-		return multipart;
+		// The full state does not depend on the subscriber, so it can be shared by all the devices subscribing
+		// before the next change of the conference.
+		if (fullStateCache.isEmpty() || (fullStateCacheNotifyId != lastNotify) ||
+		    (fullStateCacheDeflated != deflateParts)) {
+			auto content = createNotifyFullState(ev, deflateParts);
+			list<Content *> contentPtrs;
+			contentPtrs.push_back(&content);
+			fullStateCache = ContentManager::contentListToMultipart(contentPtrs);
+			fullStateCacheNotifyId = lastNotify;
+			fullStateCacheDeflated = deflateParts;
+		}
+		return fullStateCache;
 	} else if (notifyId < static_cast<int>(lastNotify)) {
-		return createNotifyMultipart(notifyId);
+		return createNotifyMultipart(notifyId, deflateParts);
 	}
 
 	return Content();
 }
 
-Content LocalConferenceEventHandler::makeContent(const std::string &xml) {
+Content LocalConferenceEventHandler::makeContent(const std::string &xml, bool deflate) {
 	Content content;
 	content.setContentType(ContentType::ConferenceInfo);
-	if (linphone_core_content_encoding_supported(conf->getCore()->getCCore(), "deflate"))
+	if (deflate && linphone_core_content_encoding_supported(conf->getCore()->getCCore(), "deflate"))
 		content.setContentEncoding("deflate");
 	content.setBodyFromUtf8(xml);
 	return content;
@@ -62,15 +62,16 @@ public:
 	LinphoneStatus subscribeReceived(const std::shared_ptr<EventSubscribe> &ev);
 	void subscriptionStateChanged(const std::shared_ptr<EventSubscribe> &ev, LinphoneSubscriptionState state);
 
-	Content getNotifyForId(int notifyId, const std::shared_ptr<EventSubscribe> &ev);
+	// The parts are not deflated when deflateParts is false, for callers that deflate the whole body they are put in.
+	Content getNotifyForId(int notifyId, const std::shared_ptr<EventSubscribe> &ev, bool deflateParts = true);
 
 	// protected:
 	void notifyFullState(const Content &notify, const std::shared_ptr<ParticipantDevice> &device);
 	void notifyAllExcept(const Content &notify, const std::shared_ptr<Participant> &exceptParticipant);
 	void notifyAllExceptDevice(const Content &notify, const std::shared_ptr<ParticipantDevice> &exceptDevice);
 	void notifyAll(const Content &notify);
-	Content createNotifyFullState(const std::shared_ptr<EventSubscribe> &ev);
-	Content createNotifyMultipart(int notifyId);
+	Content createNotifyFullState(const std::shared_ptr<EventSubscribe> &ev, bool deflate = true);
+	Content createNotifyMultipart(int notifyId, bool deflate = true);
 
 	// Conference
 	std::string createNotifyAvailableMediaChanged(const std::map<ConferenceMediaCapabilities, bool> mediaCapabilities);
@@ -213,9 +214,10 @@ private:
 	std::string createNotifySubjectChanged(const std::string &subject);
 	std::string createNotifyEphemeralLifetime(const long &lifetime);
 	std::string createNotifyEphemeralMode(const EventLog::Type &type);
-	Content makeContent(const std::string &xml);
+	Content makeContent(const std::string &xml, bool deflate = true);
 	void notifyParticipant(const Content &notify, const std::shared_ptr<Participant> &participant);
 	void notifyParticipantDevice(const Content &notify, const std::shared_ptr<ParticipantDevice> &device);
+	void invalidateFullStateCache();
 
 	std::shared_ptr<Participant> getConferenceParticipant(const std::shared_ptr<Address> &address) const;
 
@@ -230,6 +232,11 @@ private:
 	                                   const LinphoneMediaDirection textDirection,
 	                                   Xsd::ConferenceInfo::ConferenceDescriptionType &confDescr);
 
+	// Last full state multipart built by getNotifyForId() and the notify id it was built for.
+	Content fullStateCache;
+	unsigned int fullStateCacheNotifyId = 0;
+	bool fullStateCacheDeflated = false;
+
 	L_DISABLE_COPY(LocalConferenceEventHandler);
 };
 
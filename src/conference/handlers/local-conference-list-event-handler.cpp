@@ -93,14 +93,8 @@ void LocalConferenceListEventHandler::subscribeReceived(const std::shared_ptr<Ev
 		return;
 
 	const auto &participantAddr = ev->getFrom();
-	const auto &deviceAddr = ev->getRemoteContact();
-
-	// Create Rlmi body
-	Xsd::Rlmi::List::ResourceSequence resources;
 
 	// Parse resource list
-	bool noContent = true;
-	list<Content> contents;
 	istringstream data(xmlBody);
 	unique_ptr<Xsd::ResourceLists::ResourceLists> rl;
 	try {
@@ -110,61 +104,116 @@ void LocalConferenceListEventHandler::subscribeReceived(const std::shared_ptr<Ev
 		return;
 	}
 
+	auto pending = make_shared<PendingNotify>();
+	pending->ev = ev;
+	pending->subscriptionState = subscriptionState;
+	pending->deflate = linphone_core_content_encoding_supported(getCore()->getCCore(), "deflate");
 	for (const auto &l : rl->getList()) {
 		for (const auto &entry : l.getEntry()) {
 			std::shared_ptr<Address> addr = Address::create(entry.getUri());
 			string notifyIdStr = addr->getUriParamValue("Last-Notify");
 			addr->removeUriParam("Last-Notify");
-			ConferenceId conferenceId(addr, addr);
-			LocalConferenceEventHandler *handler = findHandler(conferenceId);
-			if (!handler) continue;
-
-			shared_ptr<AbstractChatRoom> chatRoom = ev->getCore()->findChatRoom(conferenceId);
-			if (!chatRoom) {
-				lError() << "Received subscribe for unknown chat room: " << conferenceId;
-				continue;
-			}
-
-			shared_ptr<Participant> participant = chatRoom->findParticipant(participantAddr);
-			if (!participant) {
-				lError() << "Received subscribe for unknown participant: " << participantAddr
-				         << " for chat room: " << conferenceId;
-				continue;
-			}
-			shared_ptr<ParticipantDevice> device = participant->findDevice(deviceAddr);
-			if (!device || (device->getState() != ParticipantDevice::State::Present &&
-			                device->getState() != ParticipantDevice::State::Joining)) {
-				lError() << "Received subscribe for unknown device: " << deviceAddr
-				         << " for participant: " << participantAddr << " for chat room: " << conferenceId;
-				continue;
-			}
-			device->setConferenceSubscribeEvent((subscriptionState == LinphoneSubscriptionIncomingReceived) ? ev
-			                                                                                                : nullptr);
-
-			int notifyId = (notifyIdStr.empty() || device->getState() == ParticipantDevice::State::Joining)
-			                   ? 0
-			                   : Utils::stoi(notifyIdStr);
-			Content content = handler->getNotifyForId(notifyId, device->getConferenceSubscribeEvent());
-			if (content.isEmpty()) continue;
-
-			noContent = false;
-			char token[17];
-			belle_sip_random_token(token, sizeof(token));
-			content.addHeader("Content-Id", token);
-			content.addHeader("Content-Length", Utils::toString(content.getSize()));
-			contents.push_back(std::move(content));
-
-			// Add entry into the Rlmi content of the notify body
-			Xsd::Rlmi::Resource resource(addr->asStringUriOnly());
-			Xsd::Rlmi::Resource::InstanceSequence instances;
-			Xsd::Rlmi::Instance instance(token, Xsd::Rlmi::State::Value::active);
-			instances.push_back(instance);
-			resource.setInstance(instances);
-			resources.push_back(resource);
+			pending->entries.emplace_back(addr, notifyIdStr);
 		}
 	}
+	rl.reset();
+
+	if (chunkSize == 0) {
+		chunkSize = (size_t)linphone_config_get_int(linphone_core_get_config(getCore()->getCCore()), "misc",
+		                                            "conference_list_notify_chunk_size", 100);
+		if (chunkSize == 0) chunkSize = (size_t)-1;
+	}
+
+	pendingNotifies.push_back(pending);
+	processPendingNotify(pending);
+}
+
+void LocalConferenceListEventHandler::processPendingNotify(const std::shared_ptr<PendingNotify> &pending) {
+	size_t processed = 0;
+	while (!pending->entries.empty() && (processed < chunkSize)) {
+		const auto &entry = pending->entries.front();
+		addPendingNotifyEntry(*pending, entry.first, entry.second);
+		pending->entries.pop_front();
+		processed++;
+	}
+
+	if (!pending->entries.empty()) {
+		// Let the core iterate before handling the next chunk of conferences.
+		weak_ptr<PendingNotify> weakPending(pending);
+		getCore()->doLater([this, weakPending]() {
+			auto pending = weakPending.lock();
+			if (pending) processPendingNotify(pending);
+		});
+		return;
+	}
+
+	pendingNotifies.remove(pending);
+	sendPendingNotify(*pending);
+}
+
+void LocalConferenceListEventHandler::addPendingNotifyEntry(PendingNotify &pending,
+                                                            const std::shared_ptr<Address> &addr,
+                                                            const string &notifyIdStr) {
+	const auto &ev = pending.ev;
+	const auto &participantAddr = ev->getFrom();
+	const auto &deviceAddr = ev->getRemoteContact();
+
+	ConferenceId conferenceId(addr, addr);
+	LocalConferenceEventHandler *handler = findHandler(conferenceId);
+	if (!handler) return;
+
+	shared_ptr<AbstractChatRoom> chatRoom = ev->getCore()->findChatRoom(conferenceId);
+	if (!chatRoom) {
+		lError() << "Received subscribe for unknown chat room: " << conferenceId;
+		return;
+	}
+
+	shared_ptr<Participant> participant = chatRoom->findParticipant(participantAddr);
+	if (!participant) {
+		lError() << "Received subscribe for unknown participant: " << participantAddr
+		         << " for chat room: " << conferenceId;
+		return;
+	}
+	shared_ptr<ParticipantDevice> device = participant->findDevice(deviceAddr);
+	if (!device || (device->getState() != ParticipantDevice::State::Present &&
+	                device->getState() != ParticipantDevice::State::Joining)) {
+		lError() << "Received subscribe for unknown device: " << deviceAddr << " for participant: " << participantAddr
+		         << " for chat room: " << conferenceId;
+		return;
+	}
+	device->setConferenceSubscribeEvent((pending.subscriptionState == LinphoneSubscriptionIncomingReceived) ? ev
+	                                                                                                      : nullptr);
+
+	int notifyId = (notifyIdStr.empty() || device->getState() == ParticipantDevice::State::Joining)
+	                   ? 0
+	                   : Utils::stoi(notifyIdStr);
+	// The whole multipart is deflated, there is no need to compress each part beforehand.
+	Content content = handler->getNotifyForId(notifyId, device->getConferenceSubscribeEvent(), !pending.deflate);
+	if (content.isEmpty()) return;
+
+	char token[17];
+	belle_sip_random_token(token, sizeof(token));
+	content.addHeader("Content-Id", token);
+	content.addHeader("Content-Length", Utils::toString(content.getSize()));
+	pending.contents.push_back(std::move(content));
+	pending.resources.emplace_back(addr->asStringUriOnly(), token);
+}
 
-	if (noContent) return;
+void LocalConferenceListEventHandler::sendPendingNotify(PendingNotify &pending) {
+	if (pending.contents.empty()) return;
+
+	// Create Rlmi body
+	Xsd::Rlmi::List::ResourceSequence resources;
+	for (const auto &r : pending.resources) {
+		// Add entry into the Rlmi content of the notify body
+		Xsd::Rlmi::Resource resource(r.first);
+		Xsd::Rlmi::Resource::InstanceSequence instances;
+		Xsd::Rlmi::Instance instance(r.second, Xsd::Rlmi::State::Value::active);
+		instances.push_back(instance);
+		resource.setInstance(instances);
+		resources.push_back(resource);
+	}
+	pending.resources.clear();
 
 	Xsd::Rlmi::List rlmiList("", 0, TRUE);
 	rlmiList.setResource(resources);
@@ -178,19 +227,19 @@ void LocalConferenceListEventHandler::subscribeReceived(const std::shared_ptr<Ev
 
 	list<Content *> contentsAsPtr;
 	contentsAsPtr.push_back(&rlmiContent);
-	for (Content &content : contents) {
+	for (Content &content : pending.contents) {
 		contentsAsPtr.push_back(&content);
 	}
 
 	Content multipart = ContentManager::contentListToMultipart(contentsAsPtr);
-	if (linphone_core_content_encoding_supported(getCore()->getCCore(), "deflate"))
-		multipart.setContentEncoding("deflate");
+	pending.contents.clear();
+	if (pending.deflate) multipart.setContentEncoding("deflate");
 	LinphoneContent *cContent = L_GET_C_BACK_PTR(&multipart);
 	shared_ptr<EventCbs> cbs = EventCbs::create();
 	cbs->setUserData(this);
 	cbs->notifyResponseCb = notifyResponseCb;
-	ev->addCallbacks(cbs);
-	ev->notify(cContent);
+	pending.ev->addCallbacks(cbs);
+	pending.ev->notify(cContent);
 }
 
 // -----------------------------------------------------------------------------
@@ -21,9 +21,11 @@
 #ifndef _L_LOCAL_CONFERENCE_LIST_EVENT_HANDLER_H_
 #define _L_LOCAL_CONFERENCE_LIST_EVENT_HANDLER_H_
 
+#include <list>
 #include <unordered_map>
 
 #include "conference/conference-id.h"
+#include "content/content.h"
 #include "core/core-accessor.h"
 #include "event/event-subscribe.h"
 #include "linphone/utils/general.h"
@@ -46,7 +48,25 @@ public:
 	static void notifyResponseCb(const LinphoneEvent *lev);
 
 private:
+	// State of a list subscription whose NOTIFY body is being built across several core iterations.
+	struct PendingNotify {
+		std::shared_ptr<EventSubscribe> ev;
+		LinphoneSubscriptionState subscriptionState;
+		std::list<std::pair<std::shared_ptr<Address>, std::string>> entries;
+		std::list<std::pair<std::string, std::string>> resources;
+		std::list<Content> contents;
+		bool deflate = false;
+	};
+
+	void processPendingNotify(const std::shared_ptr<PendingNotify> &pending);
+	void addPendingNotifyEntry(PendingNotify &pending,
+	                           const std::shared_ptr<Address> &addr,
+	                           const std::string &notifyIdStr);
+	void sendPendingNotify(PendingNotify &pending);
+
 	std::unordered_map<ConferenceId, LocalConferenceEventHandler *> handlers;
+	std::list<std::shared_ptr<PendingNotify>> pendingNotifies;
+	size_t chunkSize = 0;
 };
 
 LINPHONE_END_NAMESPACE
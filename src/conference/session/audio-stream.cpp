@@ -23,6 +23,7 @@
 #include "call/call.h"
 #include "conference/params/media-session-params-p.h"
 #include "conference/participant.h"
+#include "core/core-settings.h"
 #include "core/core.h"
 #include "media-session-p.h"
 #include "media-session.h"
@@ -757,17 +758,17 @@ void MS2AudioStream::postConfigureAudioStream(AudioStream *as, LinphoneCore *lc,
 	/* Set microphone enablement */
 	enableMicOnAudioStream(as, lc, !muted);
 
-	LinphoneConfig *config = linphone_core_get_config(lc);
-	float ngThres = linphone_config_get_float(config, "sound", "ng_thres", 0.05f);
-	float ngFloorGain = linphone_config_get_float(config, "sound", "ng_floorgain", 0);
+	const auto settings = L_GET_CPP_PTR_FROM_C_OBJECT(lc)->getSettings();
+	float ngThres = settings->sound.ngThres;
+	float ngFloorGain = settings->sound.ngFloorGain;
 	if (as->volsend) {
-		int dcRemoval = linphone_config_get_int(config, "sound", "dc_removal", 0);
+		int dcRemoval = settings->sound.dcRemoval;
 		ms_filter_call_method(as->volsend, MS_VOLUME_REMOVE_DC, &dcRemoval);
-		float speed = linphone_config_get_float(config, "sound", "el_speed", -1);
-		float thres = linphone_config_get_float(config, "sound", "el_thres", -1);
-		float force = linphone_config_get_float(config, "sound", "el_force", -1);
-		int sustain = linphone_config_get_int(config, "sound", "el_sustain", -1);
-		float transmitThres = linphone_config_get_float(config, "sound", "el_transmit_thres", -1);
+		float speed = settings->sound.elSpeed;
+		float thres = settings->sound.elThres;
+		float force = settings->sound.elForce;
+		int sustain = settings->sound.elSustain;
+		float transmitThres = settings->sound.elTransmitThres;
 		if (static_cast<int>(speed) == -1) speed = 0.03f;
 		if (static_cast<int>(force) == -1) force = 25;
 		MSFilter *f = as->volsend;
@@ -783,7 +784,7 @@ void MS2AudioStream::postConfigureAudioStream(AudioStream *as, LinphoneCore *lc,
 	if (as->volrecv) {
 		/* Parameters for a limited noise-gate effect, using echo limiter threshold */
 		float floorGain = (float)(1 / pow(10, lc->sound_conf.soft_mic_lev / 10));
-		int spkAgc = linphone_config_get_int(config, "sound", "speaker_agc_enabled", 0);
+		int spkAgc = settings->sound.speakerAgcEnabled;
 		MSFilter *f = as->volrecv;
 		ms_filter_call_method(f, MS_VOLUME_ENABLE_AGC, &spkAgc);
 		ms_filter_call_method(f, MS_VOLUME_SET_NOISE_GATE_THRESHOLD, &ngThres);
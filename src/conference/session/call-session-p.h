@@ -44,6 +44,9 @@ public:
 	void setTransferState(CallSession::State newState);
 	void startIncomingNotification();
 	bool startPing();
+	// (Re)arms the timer firing at the nearest timeout applying to the current state, or stops it if there is none.
+	void updateDeadlineTimer();
+	void stopDeadlineTimer();
 	void setPingTime(int value) {
 		pingTime = value;
 	}
@@ -161,6 +164,8 @@ protected:
 	bool pingReplied = false;
 	int pingTime = 0;
 
+	belle_sip_source_t *deadlineTimer = nullptr;
+
 	std::shared_ptr<CallSession> referer;
 	std::shared_ptr<CallSession> transferTarget;
 
@@ -182,6 +187,9 @@ private:
 
 	std::shared_ptr<Address> getFixedContact() const;
 
+	time_t getNextDeadline() const;
+	void handleDeadlines(time_t currentRealTime);
+
 	void repairIfBroken();
 
 	L_DECLARE_PUBLIC(CallSession);
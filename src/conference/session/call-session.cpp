@@ -33,6 +33,7 @@
 #include "conference/session/call-session-p.h"
 #include "conference/session/call-session.h"
 #include "core/core-p.h"
+#include "core/core-settings.h"
 #include "factory/factory.h"
 #include "logger/logger.h"
 
@@ -235,6 +236,9 @@ void CallSessionPrivate::setState(CallSession::State newState, const string &mes
 				break;
 		}
 
+		// Timeouts are evaluated when they are due rather than on each core iteration.
+		updateDeadlineTimer();
+
 		if (message.empty()) {
 			lError() << "You must fill a reason when changing call state (from " << Utils::toString(prevState) << " to "
 			         << Utils::toString(state) << ")";
@@ -351,11 +355,42 @@ bool CallSessionPrivate::startPing() {
 			ms_free(to);
 		}
 		pingOp->setUserPointer(this);
+		updateDeadlineTimer();
 		return true;
 	}
 	return false;
 }
 
+void CallSessionPrivate::updateDeadlineTimer() {
+	L_Q();
+	stopDeadlineTimer();
+	time_t deadline = getNextDeadline();
+	if (deadline == 0) return;
+
+	time_t now = ms_time(nullptr);
+	// A deadline that has already been handled without changing the state is checked again every second.
+	unsigned int delayMs = (deadline > now) ? static_cast<unsigned int>(deadline - now) * 1000 : 1000;
+	deadlineTimer = q->getCore()->createTimer(
+	    [this]() {
+		    L_Q();
+		    // Keep a ref on the CallSession, the timeouts may terminate it
+		    shared_ptr<CallSession> ref = q->getSharedFromThis();
+		    belle_sip_source_t *timer = deadlineTimer;
+		    handleDeadlines(ms_time(nullptr));
+		    // A state change re-arms the timer by itself
+		    if (deadlineTimer == timer) updateDeadlineTimer();
+		    return false;
+	    },
+	    delayMs, "CallSession deadline");
+}
+
+void CallSessionPrivate::stopDeadlineTimer() {
+	if (!deadlineTimer) return;
+	belle_sip_source_cancel(deadlineTimer);
+	belle_sip_object_unref(deadlineTimer);
+	deadlineTimer = nullptr;
+}
+
 // -----------------------------------------------------------------------------
 
 void CallSessionPrivate::setParams(CallSessionParams *csp) {
@@ -594,8 +629,7 @@ void CallSessionPrivate::terminated() {
 
 void CallSessionPrivate::updated(bool isUpdate) {
 	L_Q();
-	deferUpdate = !!linphone_config_get_int(linphone_core_get_config(q->getCore()->getCCore()), "sip",
-	                                        "defer_update_default", FALSE);
+	deferUpdate = q->getCore()->getSettings()->sip.deferUpdateDefault;
 	SalErrorInfo sei;
 	memset(&sei, 0, sizeof(sei));
 	CallSession::State localState = state; // Member variable "state" may be changed within this function
@@ -705,8 +739,7 @@ void CallSessionPrivate::accept(const CallSessionParams *csp) {
 void CallSessionPrivate::acceptOrTerminateReplacedSessionInIncomingNotification() {
 	L_Q();
 	CallSession *replacedSession = nullptr;
-	if (linphone_config_get_int(linphone_core_get_config(q->getCore()->getCCore()), "sip",
-	                            "auto_answer_replacing_calls", 1)) {
+	if (q->getCore()->getSettings()->sip.autoAnswerReplacingCalls) {
 		if (op->getReplaces()) replacedSession = static_cast<CallSession *>(op->getReplaces()->getUserPointer());
 		if (replacedSession) {
 			switch (replacedSession->getState()) {
@@ -1059,6 +1092,52 @@ std::shared_ptr<Address> CallSessionPrivate::getFixedContact() const {
 	return result;
 }
 
+// Returns the time at which the first timeout checked by handleDeadlines() is reached, or 0 if none applies.
+time_t CallSessionPrivate::getNextDeadline() const {
+	L_Q();
+	if (!log || (state == CallSession::State::End) || (state == CallSession::State::Error) ||
+	    (state == CallSession::State::Released))
+		return 0;
+	const auto &sipConf = q->getCore()->getCCore()->sip_conf;
+	time_t deadline = 0;
+	auto consider = [&deadline](time_t value) {
+		if ((deadline == 0) || (value < deadline)) deadline = value;
+	};
+	// Timeouts are reached once strictly more seconds than their value have elapsed
+	if ((state == CallSession::State::OutgoingInit) && pingOp)
+		consider(log->getStartTime() + sipConf.delayed_timeout + 1);
+	if ((state == CallSession::State::IncomingReceived) || (state == CallSession::State::IncomingEarlyMedia))
+		consider(log->getStartTime() + sipConf.inc_timeout + 1);
+	if ((direction == LinphoneCallIncoming) && !op)
+		consider(log->getStartTime() + sipConf.push_incoming_call_timeout + 1);
+	if ((sipConf.in_call_timeout > 0) && (log->getConnectedTime() != 0))
+		consider(log->getConnectedTime() + sipConf.in_call_timeout + 1);
+	return deadline;
+}
+
+void CallSessionPrivate::handleDeadlines(time_t currentRealTime) {
+	L_Q();
+	const auto &sipConf = q->getCore()->getCCore()->sip_conf;
+	int elapsed = (int)(currentRealTime - log->getStartTime());
+	if ((state == CallSession::State::OutgoingInit) && (elapsed > sipConf.delayed_timeout) && (pingOp != nullptr)) {
+		/* Start the call even if the OPTIONS reply did not arrive */
+		q->startInvite(nullptr, "");
+	}
+	if ((state == CallSession::State::IncomingReceived) || (state == CallSession::State::IncomingEarlyMedia)) {
+		if (listener) listener->onIncomingCallSessionTimeoutCheck(q->getSharedFromThis(), elapsed, true);
+	}
+
+	if (direction == LinphoneCallIncoming && !op) {
+		if (listener) listener->onPushCallSessionTimeoutCheck(q->getSharedFromThis(), elapsed);
+	}
+
+	if ((sipConf.in_call_timeout > 0) && (log->getConnectedTime() != 0) &&
+	    ((currentRealTime - log->getConnectedTime()) > sipConf.in_call_timeout)) {
+		lInfo() << "In call timeout (" << sipConf.in_call_timeout << ")";
+		q->terminate();
+	}
+}
+
 // -----------------------------------------------------------------------------
 
 void CallSessionPrivate::reinviteToRecoverFromConnectionLoss() {
@@ -1089,9 +1168,7 @@ void CallSessionPrivate::repairIfBroken() {
 
 	try {
 		LinphoneCore *lc = q->getCore()->getCCore();
-		LinphoneConfig *config = linphone_core_get_config(lc);
-		if (!linphone_config_get_int(config, "sip", "repair_broken_calls", 1) ||
-		    !lc->media_network_state.global_state || !broken)
+		if (!q->getCore()->getSettings()->sip.repairBrokenCalls || !lc->media_network_state.global_state || !broken)
 			return;
 	} catch (const bad_weak_ptr &) {
 		return; // Cannot repair if core is destroyed.
@@ -1193,6 +1270,7 @@ CallSession::~CallSession() {
 	if (d->remoteParams) delete d->remoteParams;
 	if (d->ei) linphone_error_info_unref(d->ei);
 	if (d->op) d->op->release();
+	d->stopDeadlineTimer();
 }
 
 // -----------------------------------------------------------------------------
@@ -1404,29 +1482,6 @@ bool CallSession::initiateOutgoing(BCTBX_UNUSED(const string &subject), BCTBX_UN
 	return defer;
 }
 
-void CallSession::iterate(time_t currentRealTime, bool oneSecondElapsed) {
-	L_D();
-	int elapsed = (int)(currentRealTime - d->log->getStartTime());
-	if ((d->state == CallSession::State::OutgoingInit) && (elapsed > getCore()->getCCore()->sip_conf.delayed_timeout) &&
-	    (d->pingOp != nullptr)) {
-		/* Start the call even if the OPTIONS reply did not arrive */
-		startInvite(nullptr, "");
-	}
-	if ((d->state == CallSession::State::IncomingReceived) || (d->state == CallSession::State::IncomingEarlyMedia)) {
-		if (d->listener) d->listener->onIncomingCallSessionTimeoutCheck(getSharedFromThis(), elapsed, oneSecondElapsed);
-	}
-
-	if (d->direction == LinphoneCallIncoming && !isOpConfigured()) {
-		if (d->listener) d->listener->onPushCallSessionTimeoutCheck(getSharedFromThis(), elapsed);
-	}
-
-	if ((getCore()->getCCore()->sip_conf.in_call_timeout > 0) && (d->log->getConnectedTime() != 0) &&
-	    ((currentRealTime - d->log->getConnectedTime()) > getCore()->getCCore()->sip_conf.in_call_timeout)) {
-		lInfo() << "In call timeout (" << getCore()->getCCore()->sip_conf.in_call_timeout << ")";
-		terminate();
-	}
-}
-
 LinphoneStatus CallSession::redirect(const string &redirectUri) {
 	auto address = getCore()->interpretUrl(redirectUri, true);
 	if (!address || !address->isValid()) {
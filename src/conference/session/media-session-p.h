@@ -319,6 +319,8 @@ private:
 	bool hasAvpf(const std::shared_ptr<SalMediaDescription> &md) const;
 	void queueIceGatheringTask(const std::function<LinphoneStatus()> &lambda);
 	void runIceGatheringTasks();
+	LinphoneStatus sendLateIceCandidates();
+	LinphoneStatus sendIceCompletedUpdate();
 
 	void queueIceCompletionTask(const std::function<LinphoneStatus()> &lambda);
 	void runIceCompletionTasks();
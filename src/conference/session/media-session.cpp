@@ -33,6 +33,7 @@
 #include "conference/session/media-session.h"
 #include "conference/session/streams.h"
 #include "core/core-p.h"
+#include "core/core-settings.h"
 #include "sal/call-op.h"
 #include "sal/params/sal_media_description_params.h"
 #include "sal/sal.h"
@@ -470,8 +471,7 @@ bool MediaSessionPrivate::failure() {
 		case SalReasonUnsupportedContent: /* This is for compatibility: linphone sent 415 because of SDP offer answer
 		                                     failure */
 		case SalReasonNotAcceptable:
-			if ((linphone_config_get_int(linphone_core_get_config(q->getCore()->getCCore()), "sip",
-			                             "retry_invite_after_offeranswer_failure", 1)) &&
+			if (q->getCore()->getSettings()->sip.retryInviteAfterOfferAnswerFailure &&
 			    ((state == CallSession::State::OutgoingInit) || (state == CallSession::State::OutgoingProgress) ||
 			     (state == CallSession::State::OutgoingRinging) /* Push notification case */
 			     || (state == CallSession::State::OutgoingEarlyMedia))) {
@@ -543,8 +543,7 @@ void MediaSessionPrivate::pauseForTransfer() {
 void MediaSessionPrivate::pausedByRemote() {
 	L_Q();
 	MediaSessionParams newParams(*getParams());
-	if (linphone_config_get_int(linphone_core_get_config(q->getCore()->getCCore()), "sip", "inactive_video_on_pause",
-	                            0))
+	if (q->getCore()->getSettings()->sip.inactiveVideoOnPause)
 		newParams.setVideoDirection(LinphoneMediaDirectionInactive);
 
 	acceptUpdate(&newParams, CallSession::State::PausedByRemote, "Call paused by remote");
@@ -666,8 +665,7 @@ bool MediaSessionPrivate::incompatibleSecurity(const std::shared_ptr<SalMediaDes
 	L_Q();
 	if (isEncryptionMandatory()) {
 		const auto negotiatedEncryption = getNegotiatedMediaEncryption();
-		if (!!linphone_config_get_int(linphone_core_get_config(q->getCore()->getCCore()), "rtp",
-		                              "accept_any_encryption", 0)) {
+		if (q->getCore()->getSettings()->rtp.acceptAnyEncryption) {
 			if (negotiatedEncryption == LinphoneMediaEncryptionNone) {
 				lError() << "Encryption is mandatory however the negotiated encryption is "
 				         << linphone_media_encryption_to_string(negotiatedEncryption);
@@ -694,7 +692,7 @@ void MediaSessionPrivate::updating(bool isUpdate) {
 	if (state != CallSession::State::Paused) {
 		/* Refresh the local description, but in paused state, we don't change anything. */
 		const bool makeOffer = (rmd == nullptr);
-		if (makeOffer && linphone_config_get_int(linphone_core_get_config(q->getCore()->getCCore()), "sip", "sdp_200_ack_follow_video_policy", 0)) {
+		if (makeOffer && q->getCore()->getSettings()->sip.sdp200AckFollowVideoPolicy) {
 			lInfo() << "Applying default policy for offering SDP on CallSession [" << q << "]";
 			setParams(new MediaSessionParams());
 			// Yes we init parameters as if we were in the case of an outgoing call, because it is a resume with no SDP.
@@ -860,8 +858,7 @@ void MediaSessionPrivate::stopStreams() {
 void MediaSessionPrivate::onNetworkReachable(bool sipNetworkReachable, bool mediaNetworkReachable) {
 	L_Q();
 	if (mediaNetworkReachable) {
-		LinphoneConfig *config = linphone_core_get_config(q->getCore()->getCCore());
-		if (linphone_config_get_int(config, "net", "recreate_sockets_when_network_is_up", 0)) refreshSockets();
+		if (q->getCore()->getSettings()->net.recreateSocketsWhenNetworkIsUp) refreshSockets();
 	} else {
 		setBroken();
 	}
@@ -1005,8 +1002,7 @@ void MediaSessionPrivate::fixCallParams(std::shared_ptr<SalMediaDescription> &rm
 		// conference. If bundle mode has been accepted, then future reINVITEs or UPDATEs must reoffer bundle mode
 		// unless the user has explicitely requested to disable it
 		getParams()->enableRtpBundle(
-		    fromOffer ? (rcp->rtpBundleEnabled() &&
-		                 linphone_config_get_bool(linphone_core_get_config(cCore), "rtp", "accept_bundle", TRUE))
+		    fromOffer ? (rcp->rtpBundleEnabled() && q->getCore()->getSettings()->rtp.acceptBundle)
 		              : rcp->rtpBundleEnabled());
 	}
 }
@@ -1053,8 +1049,7 @@ void MediaSessionPrivate::setCompatibleIncomingCallParams(std::shared_ptr<SalMed
 	} else avpfRrInterval = static_cast<uint16_t>(linphone_core_get_avpf_rr_interval(lc) * 1000);
 	getParams()->setAvpfRrInterval(avpfRrInterval);
 	bool_t mandatory = linphone_core_is_media_encryption_mandatory(lc);
-	bool_t acceptAllEncryptions = !!linphone_config_get_int(linphone_core_get_config(q->getCore()->getCCore()), "rtp",
-	                                                        "accept_any_encryption", 0);
+	bool_t acceptAllEncryptions = q->getCore()->getSettings()->rtp.acceptAnyEncryption;
 
 	if (md->hasZrtp() && linphone_core_media_encryption_supported(lc, LinphoneMediaEncryptionZRTP)) {
 		if (!mandatory || (mandatory && (acceptAllEncryptions ||
@@ -1145,9 +1140,8 @@ void MediaSessionPrivate::discoverMtu(const std::shared_ptr<Address> &remoteAddr
 void MediaSessionPrivate::getLocalIp(const std::shared_ptr<Address> &remoteAddr) {
 	L_Q();
 	// Next, sometime, override from config
-	const char *ip =
-	    linphone_config_get_string(linphone_core_get_config(q->getCore()->getCCore()), "rtp", "bind_address", nullptr);
-	if (ip) {
+	const string &ip = q->getCore()->getSettings()->rtp.bindAddress;
+	if (!ip.empty()) {
 		mediaLocalIp = ip;
 		lInfo() << "Found media local-ip from configuration file: " << mediaLocalIp;
 		return;
@@ -1291,8 +1285,7 @@ void MediaSessionPrivate::selectOutgoingIpVersion() {
 			af = AF_INET6;
 		}
 
-		if (!linphone_config_get_bool(linphone_core_get_config(q->getCore()->getCCore()), "rtp", "prefer_ipv6", TRUE) &&
-		    haveIpv4) {
+		if (!q->getCore()->getSettings()->rtp.preferIpv6 && haveIpv4) {
 			// This is the case where IPv4 is to be prefered if both are available
 			af = AF_INET; // We'll use IPv4
 			lInfo() << "prefer_ipv6 is set to false, as both IP versions are available we are going to use IPv4";
@@ -1328,9 +1321,7 @@ void MediaSessionPrivate::forceStreamsDirAccordingToState(std::shared_ptr<SalMed
 					sd.setDirection(SalStreamInactive);
 				} else if (sd.getDirection() != SalStreamInactive) {
 					sd.setDirection(SalStreamSendOnly);
-					if ((sd.type == SalVideo) &&
-					    linphone_config_get_int(linphone_core_get_config(q->getCore()->getCCore()), "sip",
-					                            "inactive_video_on_pause", 0))
+					if ((sd.type == SalVideo) && q->getCore()->getSettings()->sip.inactiveVideoOnPause)
 						sd.setDirection(SalStreamInactive);
 				}
 				break;
@@ -1469,8 +1460,7 @@ SalMediaProto MediaSessionPrivate::getAudioProto(const bool useCurrentParams) co
 	SalMediaProto ret = useCurrentParams ? linphone_media_encryption_to_sal_media_proto(getNegotiatedMediaEncryption(),
 	                                                                                    getParams()->avpfEnabled())
 	                                     : getParams()->getMediaProto();
-	if (linphone_config_get_bool(linphone_core_get_config(q->getCore()->getCCore()), "misc", "no_avpf_for_audio",
-	                             false)) {
+	if (q->getCore()->getSettings()->misc.noAvpfForAudio) {
 		lInfo() << "Removing AVPF for audio mline.";
 		switch (ret) {
 			case SalProtoRtpAvpf:
@@ -1491,8 +1481,7 @@ void MediaSessionPrivate::fillRtpParameters(SalStreamDescription &stream) const
 
 	auto &cfg = stream.cfgs[stream.getActualConfigurationIndex()];
 	if (cfg.dir != SalStreamInactive) {
-		bool rtcpMux =
-		    !!linphone_config_get_int(linphone_core_get_config(q->getCore()->getCCore()), "rtp", "rtcp_mux", 0);
+		bool rtcpMux = q->getCore()->getSettings()->rtp.rtcpMux;
 		/* rtcp-mux must be enabled when bundle mode is proposed or we're using DTLS-SRTP.*/
 		cfg.rtcp_mux = rtcpMux || getParams()->rtpBundleEnabled() ||
 		               (getNegotiatedMediaEncryption() == LinphoneMediaEncryptionDTLS);
@@ -1675,7 +1664,7 @@ SalStreamDescription &MediaSessionPrivate::addStreamToMd(std::shared_ptr<SalMedi
 		    (oldSize <= protectedStreamNumber)
 		        ? md->streams.cend()
 		        : std::find_if(md->streams.cbegin() + protectedStreamNumber, md->streams.cend(),
-		                       [](const auto s) { return (s.getDirection() == SalStreamInactive); });
+		                       [](const auto &s) { return (s.getDirection() == SalStreamInactive); });
 		if (inactiveStreamIt == md->streams.cend()) {
 			md->streams.resize(oldSize + 1);
 			return md->streams[oldSize];
@@ -1694,7 +1683,7 @@ SalStreamDescription &MediaSessionPrivate::addStreamToMd(std::shared_ptr<SalMedi
 				    ((oldMdSize <= (idx + 2)) || (oldMdSize <= protectedStreamNumber))
 				        ? oldMd->streams.cend()
 				        : std::find_if(oldMd->streams.cbegin() + protectedStreamNumber, oldMd->streams.cend(),
-				                       [&stream](const auto s) { return (s.getLabel() == stream.getLabel()); });
+				                       [&stream](const auto &s) { return (s.getLabel() == stream.getLabel()); });
 				// If the stream to replace was not in the previous media description, search an inactive stream or
 				// append at the end
 				if (streamInOldMdIt == oldMd->streams.cend()) {
@@ -1702,7 +1691,7 @@ SalStreamDescription &MediaSessionPrivate::addStreamToMd(std::shared_ptr<SalMedi
 					    (oldSize <= protectedStreamNumber)
 					        ? md->streams.cend()
 					        : std::find_if(md->streams.cbegin() + protectedStreamNumber, md->streams.cend(),
-					                       [](const auto s) { return (s.getDirection() == SalStreamInactive); });
+					                       [](const auto &s) { return (s.getDirection() == SalStreamInactive); });
 					if (inactiveStreamIt == md->streams.cend()) {
 						md->streams.push_back(stream);
 					} else {
@@ -2277,8 +2266,7 @@ void MediaSessionPrivate::makeLocalMediaDescription(bool localIsOfferer,
 	}
 
 #ifdef HAVE_ADVANCED_IM
-	bool eventLogEnabled = !!linphone_config_get_bool(linphone_core_get_config(q->getCore()->getCCore()), "misc",
-	                                                  "conference_event_log_enabled", TRUE);
+	bool eventLogEnabled = q->getCore()->getSettings()->misc.conferenceEventLogEnabled;
 	if (conferenceCreated && eventLogEnabled && addVideoStream && participantDevice &&
 	    ((deviceState == ParticipantDevice::State::Joining) || (deviceState == ParticipantDevice::State::Present) ||
 	     (deviceState == ParticipantDevice::State::OnHold))) {
@@ -2369,11 +2357,9 @@ int MediaSessionPrivate::setupEncryptionKey(SalSrtpCryptoAlgo &crypto, MSCryptoS
 
 void MediaSessionPrivate::setupRtcpFb(std::shared_ptr<SalMediaDescription> &md) {
 	L_Q();
+	const auto settings = q->getCore()->getSettings();
 	for (auto &stream : md->streams) {
-		stream.setupRtcpFb(!!linphone_config_get_int(linphone_core_get_config(q->getCore()->getCCore()), "rtp",
-		                                             "rtcp_fb_generic_nack_enabled", 0),
-		                   !!linphone_config_get_int(linphone_core_get_config(q->getCore()->getCCore()), "rtp",
-		                                             "rtcp_fb_tmmbr_enabled", 1),
+		stream.setupRtcpFb(settings->rtp.rtcpFbGenericNackEnabled, settings->rtp.rtcpFbTmmbrEnabled,
 		                   getParams()->getPrivate()->implicitRtcpFbEnabled());
 		for (const auto &pt : stream.getPayloads()) {
 			PayloadTypeAvpfParams avpf_params;
@@ -2392,24 +2378,20 @@ void MediaSessionPrivate::setupRtcpFb(std::shared_ptr<SalMediaDescription> &md)
 
 void MediaSessionPrivate::setupRtcpXr(std::shared_ptr<SalMediaDescription> &md) {
 	L_Q();
-	md->rtcp_xr.enabled =
-	    !!linphone_config_get_int(linphone_core_get_config(q->getCore()->getCCore()), "rtp", "rtcp_xr_enabled", 1);
+	const auto settings = q->getCore()->getSettings();
+	md->rtcp_xr.enabled = settings->rtp.rtcpXrEnabled;
 	if (md->rtcp_xr.enabled) {
-		const char *rcvr_rtt_mode = linphone_config_get_string(linphone_core_get_config(q->getCore()->getCCore()),
-		                                                       "rtp", "rtcp_xr_rcvr_rtt_mode", "all");
+		const char *rcvr_rtt_mode = settings->rtp.rtcpXrRcvrRttMode.c_str();
 		if (strcasecmp(rcvr_rtt_mode, "all") == 0) md->rtcp_xr.rcvr_rtt_mode = OrtpRtcpXrRcvrRttAll;
 		else if (strcasecmp(rcvr_rtt_mode, "sender") == 0) md->rtcp_xr.rcvr_rtt_mode = OrtpRtcpXrRcvrRttSender;
 		else md->rtcp_xr.rcvr_rtt_mode = OrtpRtcpXrRcvrRttNone;
 		if (md->rtcp_xr.rcvr_rtt_mode != OrtpRtcpXrRcvrRttNone)
-			md->rtcp_xr.rcvr_rtt_max_size = linphone_config_get_int(linphone_core_get_config(q->getCore()->getCCore()),
-			                                                        "rtp", "rtcp_xr_rcvr_rtt_max_size", 10000);
-		md->rtcp_xr.stat_summary_enabled = !!linphone_config_get_int(linphone_core_get_config(q->getCore()->getCCore()),
-		                                                             "rtp", "rtcp_xr_stat_summary_enabled", 1);
+			md->rtcp_xr.rcvr_rtt_max_size = settings->rtp.rtcpXrRcvrRttMaxSize;
+		md->rtcp_xr.stat_summary_enabled = settings->rtp.rtcpXrStatSummaryEnabled;
 		if (md->rtcp_xr.stat_summary_enabled)
 			md->rtcp_xr.stat_summary_flags = OrtpRtcpXrStatSummaryLoss | OrtpRtcpXrStatSummaryDup |
 			                                 OrtpRtcpXrStatSummaryJitt | OrtpRtcpXrStatSummaryTTL;
-		md->rtcp_xr.voip_metrics_enabled = !!linphone_config_get_int(linphone_core_get_config(q->getCore()->getCCore()),
-		                                                             "rtp", "rtcp_xr_voip_metrics_enabled", 1);
+		md->rtcp_xr.voip_metrics_enabled = settings->rtp.rtcpXrVoipMetricsEnabled;
 
 		for (auto &stream : md->streams) {
 			stream.setupRtcpXr(md->rtcp_xr);
@@ -2437,8 +2419,7 @@ void MediaSessionPrivate::setupEncryptionKeys(std::shared_ptr<SalMediaDescriptio
                                               bool addOnlyAcceptedKeys) {
 	L_Q();
 	std::shared_ptr<SalMediaDescription> &oldMd = localDesc;
-	bool keepSrtpKeys =
-	    !!linphone_config_get_int(linphone_core_get_config(q->getCore()->getCCore()), "sip", "keep_srtp_keys", 1);
+	bool keepSrtpKeys = q->getCore()->getSettings()->sip.keepSrtpKeys;
 	const std::string attrName("crypto");
 	for (size_t i = 0; i < md->streams.size(); i++) {
 
@@ -2658,8 +2639,7 @@ std::vector<SalSrtpCryptoAlgo> MediaSessionPrivate::generateNewCryptoKeys() cons
 		}
 	}
 
-	auto cryptoId = linphone_config_get_int(linphone_core_get_config(q->getCore()->getCCore()), "sip",
-	                                        "crypto_suite_tag_starting_value", 1);
+	auto cryptoId = q->getCore()->getSettings()->sip.cryptoSuiteTagStartingValue;
 	unsigned int cryptoTag = 0;
 	// crypto tag lower than 1 is not valid
 	if (cryptoId < 1) {
@@ -2767,16 +2747,41 @@ void MediaSessionPrivate::runIceGatheringTasks() {
 	}
 }
 
+/*
+ * Sends the candidates found after an early offer, see IceService::useGatheredCandidates(). Returns non zero to be
+ * retried on next state change while the call is not in a state allowing a re-INVITE.
+ */
+LinphoneStatus MediaSessionPrivate::sendLateIceCandidates() {
+	L_Q();
+	switch (state) {
+		case CallSession::State::StreamsRunning:
+		case CallSession::State::Paused:
+		case CallSession::State::PausedByRemote: {
+			/* Once check lists are completed, only the selected candidates are advertised anyway */
+			if (getStreamsGroup().getIceService().hasCompletedCheckList()) return 0;
+			lInfo() << "MediaSession [" << q << "] sends the ICE candidates gathered after its offer";
+			MediaSessionParams newParams(*getParams());
+			newParams.getPrivate()->setInternalCallUpdate(true);
+			q->update(&newParams, CallSession::UpdateMethod::Default, q->isCapabilityNegotiationEnabled());
+			return 0;
+		}
+		case CallSession::State::End:
+		case CallSession::State::Error:
+		case CallSession::State::Released:
+			return 0;
+		default:
+			return -1;
+	}
+}
+
 bool MediaSessionPrivate::isUpdateSentWhenIceCompleted() const {
 	L_Q();
 
-	const auto core = q->getCore()->getCCore();
+	const auto settings = q->getCore()->getSettings();
 	// In case of DTLS, the update is not sent after ICE completed due to interopability issues with webRTC
 	return (getNegotiatedMediaEncryption() == LinphoneMediaEncryptionDTLS)
-	           ? linphone_config_get_bool(linphone_core_get_config(core), "sip",
-	                                      "update_call_when_ice_completed_with_dtls", false)
-	           : !!linphone_config_get_int(linphone_core_get_config(core), "sip", "update_call_when_ice_completed",
-	                                       true);
+	           ? settings->sip.updateCallWhenIceCompletedWithDtls
+	           : settings->sip.updateCallWhenIceCompleted;
 }
 
 /*
@@ -2787,24 +2792,38 @@ void MediaSessionPrivate::onGatheringFinished(BCTBX_UNUSED(IceService &service))
 	runIceGatheringTasks();
 }
 
+/*
+ * Sends the update advertising the selected ICE candidates. Returns non zero to be retried on next state change while
+ * an update of ours, such as the one sent by sendLateIceCandidates(), is still in progress.
+ */
+LinphoneStatus MediaSessionPrivate::sendIceCompletedUpdate() {
+	L_Q();
+	switch (state) {
+		case CallSession::State::StreamsRunning:
+		case CallSession::State::Paused:
+		case CallSession::State::PausedByRemote: {
+			MediaSessionParams newParams(*getParams());
+			newParams.getPrivate()->setInternalCallUpdate(true);
+			q->update(&newParams, CallSession::UpdateMethod::Default, q->isCapabilityNegotiationEnabled());
+			return 0;
+		}
+		case CallSession::State::Updating:
+			lInfo() << "MediaSession [" << q << "] sends its reINVITE for ICE once the update in progress is answered";
+			return -1;
+		default:
+			lWarning() << "Cannot send reINVITE for ICE during state " << state;
+			return 0;
+	}
+}
+
 void MediaSessionPrivate::onIceCompleted(BCTBX_UNUSED(IceService &service)) {
 	L_Q();
 
 	/* The ICE session has succeeded, so perform a call update */
 	if (!getStreamsGroup().getIceService().hasCompletedCheckList()) return;
-	if (getStreamsGroup().getIceService().isControlling() && isUpdateSentWhenIceCompleted()) {
-		switch (state) {
-			case CallSession::State::StreamsRunning:
-			case CallSession::State::Paused:
-			case CallSession::State::PausedByRemote: {
-				MediaSessionParams newParams(*getParams());
-				newParams.getPrivate()->setInternalCallUpdate(true);
-				q->update(&newParams, CallSession::UpdateMethod::Default, q->isCapabilityNegotiationEnabled());
-			} break;
-			default:
-				lWarning() << "Cannot send reINVITE for ICE during state " << state;
-				break;
-		}
+	if (getStreamsGroup().getIceService().isControlling() && isUpdateSentWhenIceCompleted() &&
+	    (sendIceCompletedUpdate() != 0)) {
+		q->addPendingAction([this]() { return sendIceCompletedUpdate(); });
 	}
 	runIceCompletionTasks();
 }
@@ -3039,8 +3058,7 @@ void MediaSessionPrivate::handleIncomingReceivedStateInIncomingNotification() {
 	/* Try to be best-effort in giving real local or routable contact address for 100Rel case */
 	setContactOp();
 	if (notifyRinging) {
-		bool proposeEarlyMedia = !!linphone_config_get_int(linphone_core_get_config(q->getCore()->getCCore()), "sip",
-		                                                   "incoming_calls_early_media", false);
+		bool proposeEarlyMedia = q->getCore()->getSettings()->sip.incomingCallsEarlyMedia;
 		if (proposeEarlyMedia) q->acceptEarlyMedia();
 		else if (state != CallSession::State::IncomingEarlyMedia) {
 			op->notifyRinging(false, linphone_core_get_tag_100rel_support_level(q->getCore()->getCCore()));
@@ -3076,9 +3094,8 @@ LinphoneStatus MediaSessionPrivate::pause() {
 	bool isInLocalConference = getParams()->getPrivate()->getInConference();
 	if (isInLocalConference) {
 		const auto contactAddress = q->getContactAddress();
-		if (!!linphone_config_get_bool(linphone_core_get_config(q->getCore()->getCCore()), "misc",
-		                               "conference_event_log_enabled", TRUE) &&
-		    contactAddress && contactAddress->hasParam("isfocus")) {
+		if (q->getCore()->getSettings()->misc.conferenceEventLogEnabled && contactAddress &&
+		    contactAddress->hasParam("isfocus")) {
 			if (listener) {
 				auto callConference = listener->getCallSessionConference(q->getSharedFromThis());
 				if (callConference) {
@@ -3276,8 +3293,7 @@ int MediaSessionPrivate::getThumbnailStreamIdx(const std::shared_ptr<SalMediaDes
 			const SalStreamDescription &mainVideoStream = md->getStreamIdx(static_cast<unsigned int>(mainStreamIdx));
 			const auto cppConference = MediaConference::Conference::toCpp(conference)->getSharedFromThis();
 			const auto meDevices = cppConference->getMe()->getDevices();
-			const bool conferenceEventPackageEnabled = linphone_config_get_bool(
-			    linphone_core_get_config(q->getCore()->getCCore()), "misc", "conference_event_log_enabled", TRUE);
+			const bool conferenceEventPackageEnabled = q->getCore()->getSettings()->misc.conferenceEventLogEnabled;
 			const bool isInLocalConference = getParams()->getPrivate()->getInConference();
 			// Devices don't have labels if conference event package is not enabled
 			const auto label = (!conferenceEventPackageEnabled || isInLocalConference || (meDevices.size() == 0))
@@ -3596,8 +3612,9 @@ MediaSessionPrivate::acceptUpdate(const CallSessionParams *csp, CallSession::Sta
 	const std::shared_ptr<SalMediaDescription> &desc = op->getRemoteMediaDescription();
 	const bool isRemoteDescNull = (desc == nullptr);
 
-	bool keepSdpVersion = !!linphone_config_get_int(linphone_core_get_config(q->getCore()->getCCore()), "sip",
-	                                                "keep_sdp_version", (op->getSal()->getSessionTimersExpire() > 0));
+	const int keepSdpVersionSetting = q->getCore()->getSettings()->sip.keepSdpVersion;
+	bool keepSdpVersion = (keepSdpVersionSetting < 0) ? (op->getSal()->getSessionTimersExpire() > 0)
+	                                                  : !!keepSdpVersionSetting;
 
 	if (keepSdpVersion && desc && (desc->session_id == remoteSessionId) && (desc->session_ver == remoteSessionVer)) {
 		/* Remote has sent an INVITE with the same SDP as before, so send a 200 OK with the same SDP as before. */
@@ -4022,7 +4039,13 @@ bool MediaSession::initiateOutgoing(const string &subject, const Content *conten
 		else {
 			/* Defer the start of the call after the ICE gathering process */
 			bool ice_needs_defer = d->getStreamsGroup().prepare();
-			if (!ice_needs_defer) {
+			if (ice_needs_defer && d->getIceService().isEarlyOfferEnabled()) {
+				/* Send the offer right away with the candidates already known, the other ones follow in a re-INVITE */
+				d->getIceService().useGatheredCandidates();
+				d->updateLocalMediaDescriptionFromIce(d->localIsOfferer);
+				d->queueIceGatheringTask([d]() { return d->sendLateIceCandidates(); });
+				ice_needs_defer = false;
+			} else if (!ice_needs_defer) {
 				/*
 				 * If ICE gathering is done, we can update the local media description immediately.
 				 * Otherwise, we'll get the ORTP_EVENT_ICE_GATHERING_FINISHED event later.
@@ -4047,10 +4070,6 @@ bool MediaSession::initiateOutgoing(const string &subject, const Content *conten
 	return defer;
 }
 
-void MediaSession::iterate(time_t currentRealTime, bool oneSecondElapsed) {
-	CallSession::iterate(currentRealTime, oneSecondElapsed);
-}
-
 LinphoneStatus MediaSession::pauseFromConference() {
 	L_D();
 	updateContactAddressInOp();
@@ -4213,8 +4232,7 @@ LinphoneStatus MediaSession::sendDtmfs(const std::string &dtmfs) {
 		return -2;
 	}
 	if (!dtmfs.empty()) {
-		int delayMs =
-		    linphone_config_get_int(linphone_core_get_config(getCore()->getCCore()), "net", "dtmf_delay_ms", 200);
+		int delayMs = getCore()->getSettings()->net.dtmfDelayMs;
 		if (delayMs < 0) delayMs = 0;
 		d->dtmfSequence = dtmfs;
 		d->dtmfTimer = getCore()->getCCore()->sal->createTimer(
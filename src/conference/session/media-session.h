@@ -77,7 +77,6 @@ public:
 	LinphoneStatus deferUpdate() override;
 	void initiateIncoming() override;
 	bool initiateOutgoing(const std::string &subject = "", const Content *content = nullptr) override;
-	void iterate(time_t currentRealTime, bool oneSecondElapsed) override;
 	LinphoneStatus pauseFromConference();
 	LinphoneStatus pause();
 	LinphoneStatus resume();
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2010-2022 Belledonne Communications SARL.
+ *
+ * This file is part of Liblinphone
+ * (see https://gitlab.linphone.org/BC/public/liblinphone).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+
+#include "bctoolbox/port.h"
+
+#include "logger/logger.h"
+#include "rtp-port-allocator.h"
+
+// =============================================================================
+
+using namespace std;
+
+LINPHONE_BEGIN_NAMESPACE
+
+int RtpPortAllocator::reserve(pair<int, int> portRange) {
+	const int first = portRange.first;
+	const int last = min(portRange.second, maxPort);
+	if ((first <= 0) || (first > last)) {
+		lError() << "Invalid RTP port range [" << portRange.first << ", " << portRange.second << "]";
+		return -1;
+	}
+
+	if (first == last) {
+		for (int triedPort = first; triedPort < (first + fixedRangeSize); triedPort += 2) {
+			if (isPairFree(triedPort)) return reservePair(triedPort);
+		}
+	} else {
+		/* If the range starts with an odd number, the RTP ports will be odd too. */
+		const unsigned int rangeSize = static_cast<unsigned int>(last - first);
+		const unsigned int slotCount = (rangeSize + 1) / 2;
+		for (int nbTries = 0; nbTries < maxRandomTries; nbTries++) {
+			const int triedPort = static_cast<int>(bctbx_random() % slotCount) * 2 + first;
+			if (isPairFree(triedPort)) return reservePair(triedPort);
+		}
+		/* The range is almost full, look for the remaining free pairs from a random position */
+		const unsigned int startSlot = bctbx_random() % slotCount;
+		for (unsigned int i = 0; i < slotCount; i++) {
+			const int triedPort = static_cast<int>((startSlot + i) % slotCount) * 2 + first;
+			if (isPairFree(triedPort)) return reservePair(triedPort);
+		}
+	}
+
+	exhaustionCount++;
+	lError() << "Could not find any free port in range [" << portRange.first << ", " << portRange.second << "], "
+	         << reservedCount << " ports reserved";
+	return -1;
+}
+
+void RtpPortAllocator::release(int rtpPort) {
+	if ((rtpPort <= 0) || (rtpPort >= maxPort) || !used.test(static_cast<size_t>(rtpPort))) return;
+	used.reset(static_cast<size_t>(rtpPort));
+	used.reset(static_cast<size_t>(rtpPort + 1));
+	reservedCount--;
+}
+
+bool RtpPortAllocator::isUsed(int port) const {
+	if ((port <= 0) || (port > maxPort)) return false;
+	return used.test(static_cast<size_t>(port));
+}
+
+bool RtpPortAllocator::isPairFree(int rtpPort) const {
+	if (rtpPort >= maxPort) return false;
+	return !used.test(static_cast<size_t>(rtpPort)) && !used.test(static_cast<size_t>(rtpPort + 1));
+}
+
+int RtpPortAllocator::reservePair(int rtpPort) {
+	used.set(static_cast<size_t>(rtpPort));
+	used.set(static_cast<size_t>(rtpPort + 1));
+	reservedCount++;
+	return rtpPort;
+}
+
+LINPHONE_END_NAMESPACE
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2010-2022 Belledonne Communications SARL.
+ *
+ * This file is part of Liblinphone
+ * (see https://gitlab.linphone.org/BC/public/liblinphone).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _L_RTP_PORT_ALLOCATOR_H_
+#define _L_RTP_PORT_ALLOCATOR_H_
+
+#include <bitset>
+#include <utility>
+
+#include "linphone/utils/general.h"
+
+// =============================================================================
+
+LINPHONE_BEGIN_NAMESPACE
+
+/*
+ * Keeps track of the RTP/RTCP port pairs used by the streams of a core, so that a free pair is found without looking
+ * at every stream of every call. A RTP port and the following RTCP port are reserved together.
+ */
+class LINPHONE_PUBLIC RtpPortAllocator {
+public:
+	// Reserves a free pair in the range and returns its RTP port, or -1 if the range is exhausted.
+	// Like the port range settings, a range whose bounds are equal means that ports are taken in order from its
+	// first port, otherwise an even port of the range is picked randomly.
+	int reserve(std::pair<int, int> portRange);
+	void release(int rtpPort);
+
+	bool isUsed(int port) const;
+	size_t getReservedCount() const {
+		return reservedCount;
+	}
+	// Number of reservations that failed because no pair was free in the requested range.
+	unsigned int getExhaustionCount() const {
+		return exhaustionCount;
+	}
+
+private:
+	static constexpr int maxPort = 65535;
+	// Number of ports tried from the first one of a fixed range
+	static constexpr int fixedRangeSize = 100;
+	// Number of random picks before looking for a free pair in the whole range
+	static constexpr int maxRandomTries = 100;
+
+	bool isPairFree(int rtpPort) const;
+	int reservePair(int rtpPort);
+
+	std::bitset<maxPort + 1> used;
+	size_t reservedCount = 0;
+	unsigned int exhaustionCount = 0;
+};
+
+LINPHONE_END_NAMESPACE
+
+#endif // ifndef _L_RTP_PORT_ALLOCATOR_H_
@@ -24,9 +24,10 @@
 #include "call/call.h"
 #include "conference/params/media-session-params-p.h"
 #include "conference/participant.h"
-#include "core/core.h"
+#include "core/core-p.h"
 #include "media-session-p.h"
 #include "media-session.h"
+#include "rtp-port-allocator.h"
 #include "streams.h"
 #include "utils/payload-type-handler.h"
 
@@ -47,6 +48,14 @@ Stream::Stream(StreamsGroup &sg, const OfferAnswerContext &params)
 	memset(&mInternalStats, 0, sizeof(mInternalStats));
 }
 
+Stream::~Stream() {
+	auto portAllocator = mPortAllocator.lock();
+	if (portAllocator) {
+		portAllocator->release(mReservedRtpPort);
+		portAllocator->release(mReservedMulticastRtpPort);
+	}
+}
+
 void Stream::resetMain() {
 	mIsMain = false;
 }
@@ -127,67 +136,20 @@ void Stream::setRandomPortConfig() {
 	mPortConfig.rtcpPort = -1;
 }
 
-int Stream::selectRandomPort(pair<int, int> portRange) {
-	unsigned int rangeSize = static_cast<unsigned int>(portRange.second - portRange.first);
-
-	for (int nbTries = 0; nbTries < 100; nbTries++) {
-		bool alreadyUsed = false;
-		unsigned int randomInRangeSize = (bctbx_random() % rangeSize) & (unsigned int)~0x1; /* Select an even number */
-		int triedPort = ((int)randomInRangeSize) + portRange.first;
-		/*If portRange.first is even, the triedPort will be even too. The one who configures a port range that starts
-		 * with an odd number will get odd RTP port numbers.*/
-
-		for (const bctbx_list_t *elem = linphone_core_get_calls(getCCore()); elem != nullptr;
-		     elem = bctbx_list_next(elem)) {
-			LinphoneCall *lcall = static_cast<LinphoneCall *>(bctbx_list_get_data(elem));
-			shared_ptr<MediaSession> session =
-			    static_pointer_cast<MediaSession>(LinphonePrivate::Call::toCpp(lcall)->getActiveSession());
-			if (session->getPrivate()->getStreamsGroup().isPortUsed(triedPort)) {
-				alreadyUsed = true;
-				break;
-			}
-		}
-		if (!alreadyUsed) {
-			lInfo() << "Port " << triedPort << " randomly taken from range [ " << portRange.first << " , "
-			        << portRange.second << "]";
-			return triedPort;
-		}
-	}
-
-	lError() << "Could not find any free port!";
-	return -1;
-}
-
-int Stream::selectFixedPort(pair<int, int> portRange) {
-	for (int triedPort = portRange.first; triedPort < (portRange.first + 100); triedPort += 2) {
-		bool alreadyUsed = false;
-		for (const bctbx_list_t *elem = linphone_core_get_calls(getCCore()); elem != nullptr;
-		     elem = bctbx_list_next(elem)) {
-			LinphoneCall *lcall = static_cast<LinphoneCall *>(bctbx_list_get_data(elem));
-			shared_ptr<MediaSession> session =
-			    static_pointer_cast<MediaSession>(LinphonePrivate::Call::toCpp(lcall)->getActiveSession());
-			if (session->getPrivate()->getStreamsGroup().isPortUsed(triedPort)) {
-				alreadyUsed = true;
-				break;
-			}
-		}
-		if (!alreadyUsed) return triedPort;
-	}
-
-	lError() << "Could not find any free port !";
-	return -1;
-}
-
 void Stream::setPortConfig(pair<int, int> portRange) {
 	if ((portRange.first <= 0) && (portRange.second <= 0)) {
 		setRandomPortConfig();
 	} else {
-		if (portRange.first == portRange.second) {
-			/* Fixed port */
-			mPortConfig.rtpPort = selectFixedPort(portRange);
-		} else {
-			/* Select random port in the specified range */
-			mPortConfig.rtpPort = selectRandomPort(portRange);
+		/* Fixed or random port in the specified range, among the ones not used by the other streams of the core */
+		auto portAllocator = getCore().getPrivate()->rtpPortAllocator;
+		mPortConfig.rtpPort = portAllocator->reserve(portRange);
+		if (mPortConfig.rtpPort != -1) {
+			if (portRange.first != portRange.second) {
+				lInfo() << "Port " << mPortConfig.rtpPort << " randomly taken from range [ " << portRange.first
+				        << " , " << portRange.second << "]";
+			}
+			mPortAllocator = portAllocator;
+			mReservedRtpPort = mPortConfig.rtpPort;
 		}
 	}
 	if (mPortConfig.rtpPort == -1) setRandomPortConfig();
@@ -239,16 +201,17 @@ void Stream::initMulticast(const OfferAnswerContext &params) {
 		mPortConfig.multicastRtpPort = mPortConfig.rtpPort;
 		if (mPortConfig.multicastRtpPort == -1) {
 			/* we have to choose the multicast port now and the system can't choose it for us.*/
-			mPortConfig.multicastRtpPort = selectRandomPort(make_pair(1024, 65535));
+			auto portAllocator = getCore().getPrivate()->rtpPortAllocator;
+			mPortConfig.multicastRtpPort = portAllocator->reserve(make_pair(1024, 65535));
+			if (mPortConfig.multicastRtpPort != -1) {
+				mPortAllocator = portAllocator;
+				mReservedMulticastRtpPort = mPortConfig.multicastRtpPort;
+			}
 		}
 		setRandomPortConfig();
 	}
 }
 
-bool Stream::isPortUsed(int port) const {
-	return port == mPortConfig.rtpPort || port == mPortConfig.rtcpPort || port == mPortConfig.multicastRtpPort;
-}
-
 IceService &Stream::getIceService() const {
 	return mStreamsGroup.getIceService();
 }
@@ -266,14 +266,6 @@ Stream *StreamsGroup::getStream(size_t index) {
 	return mStreams[index].get();
 }
 
-bool StreamsGroup::isPortUsed(int port) const {
-	if (port == -1) return false;
-	for (auto &stream : mStreams) {
-		if (stream && stream->isPortUsed(port)) return true;
-	}
-	return false;
-}
-
 LinphoneCore *StreamsGroup::getCCore() const {
 	return mMediaSession.getCore()->getCCore();
 }
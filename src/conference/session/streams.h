@@ -45,6 +45,7 @@ class MediaSessionParams;
 class IceService;
 class StreamMixer;
 class MixerSession;
+class RtpPortAllocator;
 class AudioDevice;
 
 /**
@@ -146,7 +147,6 @@ public:
 	Core &getCore() const;
 	MediaSession &getMediaSession() const;
 	MediaSessionPrivate &getMediaSessionPrivate() const;
-	bool isPortUsed(int port) const;
 	IceService &getIceService() const;
 	State getState() const {
 		return mState;
@@ -164,7 +164,7 @@ public:
 	const PortConfig &getPortConfig() const {
 		return mPortConfig;
 	}
-	virtual ~Stream() = default;
+	virtual ~Stream();
 	static std::string stateToString(State st) {
 		switch (st) {
 			case Stopped:
@@ -194,8 +194,6 @@ private:
 	void initMulticast(const OfferAnswerContext &params);
 	void resetMain();
 	void setPortConfig(std::pair<int, int> portRange);
-	int selectFixedPort(std::pair<int, int> portRange);
-	int selectRandomPort(std::pair<int, int> portRange);
 	void setPortConfig();
 	void setRandomPortConfig();
 	void fillMulticastMediaAddresses();
@@ -205,6 +203,10 @@ private:
 	State mState = Stopped;
 	StreamMixer *mMixer = nullptr;
 	bool mIsMain = false;
+	// Port pairs reserved in the core allocator, released on destruction
+	std::weak_ptr<RtpPortAllocator> mPortAllocator;
+	int mReservedRtpPort = -1;
+	int mReservedMulticastRtpPort = -1;
 };
 
 inline std::ostream &operator<<(std::ostream &ostr, const Stream &stream) {
@@ -446,7 +448,6 @@ public:
 	MixerSession *getMixerSession() const {
 		return mMixerSession;
 	}
-	bool isPortUsed(int port) const;
 	IceService &getIceService() const;
 	bool allStreamsEncrypted() const;
 	// Returns true if at least one stream was started.
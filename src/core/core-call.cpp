@@ -62,7 +62,7 @@ int CorePrivate::addCall(const shared_ptr<Call> &call) {
 		 */
 		linphone_core_stop_dtmf_stream(q->getCCore());
 	}
-	calls.push_back(call);
+	calls.add(call);
 
 	linphone_core_notify_call_created(q->getCCore(), call->toC());
 	return 0;
@@ -75,6 +75,13 @@ bool CorePrivate::canWeAddCall() const {
 	return false;
 }
 
+void CorePrivate::updateCallDeadlines() {
+	calls.forEach([](const shared_ptr<Call> &call) {
+		shared_ptr<CallSession> session = call->getActiveSession();
+		if (session) session->getPrivate()->updateDeadlineTimer();
+	});
+}
+
 bool CorePrivate::inviteReplacesABrokenCall(SalCallOp *op) {
 	CallSession *replacedSession = nullptr;
 	SalCallOp *replacedOp = op->getReplaces();
@@ -93,18 +100,8 @@ bool CorePrivate::inviteReplacesABrokenCall(SalCallOp *op) {
 }
 
 bool CorePrivate::isAlreadyInCallWithAddress(const std::shared_ptr<Address> &addr) const {
-	for (const auto &call : calls) {
-		if (call->isOpConfigured() && call->getRemoteAddress()->weakEqual(*addr)) return true;
-	}
-	return false;
-}
-
-void CorePrivate::iterateCalls(time_t currentRealTime, bool oneSecondElapsed) const {
-	// Make a copy of the list af calls because it may be altered during calls to the Call::iterate method
-	list<shared_ptr<Call>> savedCalls(calls);
-	for (const auto &call : savedCalls) {
-		call->iterate(currentRealTime, oneSecondElapsed);
-	}
+	return calls.findByRemoteAddress(*addr, [](const shared_ptr<Call> &call) { return call->isOpConfigured(); }) !=
+	       nullptr;
 }
 
 void CorePrivate::notifySoundcardUsage(bool used) {
@@ -131,8 +128,7 @@ void CorePrivate::notifySoundcardUsage(bool used) {
 
 int CorePrivate::removeCall(const shared_ptr<Call> &call) {
 	L_ASSERT(call);
-	auto iter = find(calls.begin(), calls.end(), call);
-	if (iter == calls.end()) {
+	if (!calls.remove(call)) {
 		lWarning() << "Could not find the call (local address " << call->getLocalAddress()->toString()
 		           << " remote address " << call->getRemoteAddress()->toString() << ") to remove";
 		return -1;
@@ -140,8 +136,6 @@ int CorePrivate::removeCall(const shared_ptr<Call> &call) {
 	lInfo() << "Removing the call (local address " << call->getLocalAddress()->toString() << " remote address "
 	        << (call->getRemoteAddress() ? call->getRemoteAddress()->toString() : "Unknown")
 	        << ") from the list attached to the core";
-
-	calls.erase(iter);
 	return 0;
 }
 
@@ -247,30 +241,17 @@ bool Core::areSoundResourcesLocked() const {
 
 shared_ptr<Call> Core::getCallByRemoteAddress(const std::shared_ptr<Address> &addr) const {
 	L_D();
-	for (const auto &call : d->calls) {
-		if (call->getRemoteAddress()->weakEqual(*addr)) return call;
-	}
-	return nullptr;
+	return d->calls.findByRemoteAddress(*addr);
 }
 
 shared_ptr<Call> Core::getCallByCallId(const string &callId) const {
 	L_D();
-	if (callId.empty()) {
-		return nullptr;
-	}
-
-	for (const auto &call : d->calls) {
-		if (!call->getLog()->getCallId().empty() && call->getLog()->getCallId() == callId) {
-			return call;
-		}
-	}
-
-	return nullptr;
+	return d->calls.findByCallId(callId);
 }
 
 const list<shared_ptr<Call>> &Core::getCalls() const {
 	L_D();
-	return d->calls;
+	return d->calls.getCalls();
 }
 
 unsigned int Core::getCallCount() const {
@@ -323,11 +304,7 @@ void Core::soundcardAudioRouteChanged() {
 
 LinphoneStatus Core::terminateAllCalls() {
 	L_D();
-	auto calls = d->calls;
-	while (!calls.empty()) {
-		calls.front()->terminate();
-		calls.pop_front();
-	}
+	d->calls.forEach([](const shared_ptr<Call> &call) { call->terminate(); });
 	return 0;
 }
 
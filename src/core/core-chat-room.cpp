@@ -19,6 +19,8 @@
  */
 
 #include <iterator>
+#include <unordered_set>
+#include <vector>
 
 #include <bctoolbox/defs.h>
 
@@ -28,8 +30,10 @@
 #include "chat/chat-room/abstract-chat-room.h"
 #include "chat/chat-room/basic-chat-room.h"
 #include "chat/chat-room/chat-room-p.h"
+#include "chat/encryption/encryption-engine.h"
 #include "conference/participant.h"
 #include "core-p.h"
+#include "event-log/conference/conference-chat-message-event.h"
 #include "logger/logger.h"
 
 #ifdef HAVE_ADVANCED_IM
@@ -282,6 +286,55 @@ CorePrivate::searchChatRoom(const shared_ptr<ChatRoomParams> &params,
 	return nullptr;
 }
 
+list<shared_ptr<AbstractChatRoom>>
+CorePrivate::searchOneToOneChatRooms(const shared_ptr<ChatRoomParams> &params,
+                                     const std::shared_ptr<const Address> &localAddress,
+                                     const std::list<std::shared_ptr<Address>> &participants) const {
+	// Participants are matched like Address::weakEqual() does.
+	const auto weakKey = [](const Address &address) {
+		return address.getUsername() + "@" + address.getDomain() + ":" + to_string(address.getPort());
+	};
+
+	vector<shared_ptr<AbstractChatRoom>> found(participants.size());
+	unordered_map<string, list<size_t>> indexesByKey;
+	size_t index = 0;
+	for (const auto &participant : participants)
+		indexesByKey[weakKey(*participant)].push_back(index++);
+
+	size_t remaining = participants.size();
+	for (auto it = chatRoomsById.begin(); it != chatRoomsById.end() && remaining > 0; it++) {
+		const auto &chatRoom = it->second;
+		ChatRoom::CapabilitiesMask capabilities = chatRoom->getCapabilities();
+		if (!(capabilities & ChatRoom::Capabilities::OneToOne)) continue;
+
+		if (params) {
+			if (params->getChatRoomBackend() != chatRoom->getCurrentParams()->getChatRoomBackend()) continue;
+
+			if (params->isEncrypted() != bool(capabilities & ChatRoom::Capabilities::Encrypted)) continue;
+
+			if (!params->getSubject().empty() && params->getSubject() != chatRoom->getSubject()) continue;
+		}
+
+		if (localAddress && localAddress->isValid() && (!localAddress->weakEqual(*chatRoom->getLocalAddress())))
+			continue;
+
+		for (const auto &p : chatRoom->getParticipants()) {
+			auto indexes = indexesByKey.find(weakKey(*p->getAddress()));
+			if (indexes == indexesByKey.end()) continue;
+			// The first chat room found is the one searchChatRoom() would have returned.
+			for (size_t i : indexes->second) {
+				if (!found[i]) {
+					found[i] = chatRoom;
+					remaining--;
+				}
+			}
+			indexesByKey.erase(indexes);
+		}
+	}
+
+	return list<shared_ptr<AbstractChatRoom>>(found.begin(), found.end());
+}
+
 shared_ptr<AbstractChatRoom> CorePrivate::createChatRoom(const shared_ptr<ChatRoomParams> &params,
                                                          const std::shared_ptr<const Address> &localAddr,
                                                          const std::string &subject,
@@ -444,88 +497,88 @@ void CorePrivate::loadChatRooms() {
 	for (auto &chatRoom : mainDb->getChatRooms()) {
 		insertChatRoom(chatRoom);
 	}
-	sendDeliveryNotifications();
+	if (!startupTasksDeferred) sendDeliveryNotifications();
 }
 
 void CorePrivate::handleEphemeralMessages(time_t currentTime) {
-	if (!ephemeralMessages.empty()) {
-		shared_ptr<ChatMessage> msg = ephemeralMessages.front();
-		time_t expireTime = msg->getEphemeralExpireTime();
-		if (currentTime > expireTime) {
-			shared_ptr<LinphonePrivate::EventLog> event =
-			    LinphonePrivate::MainDb::getEvent(mainDb, msg->getStorageId());
+	// Gather all the expired messages so that they are retrieved and deleted from database at once.
+	vector<EphemeralMessageExpiration> expirations;
+	list<long long> expiredStorageIds;
+	unordered_set<long long> uniqueStorageIds;
+	while (!ephemeralMessages.empty() && currentTime > ephemeralMessages.top().first) {
+		expirations.push_back(ephemeralMessages.top());
+		ephemeralMessages.pop();
+		if (uniqueStorageIds.insert(expirations.back().second).second)
+			expiredStorageIds.push_back(expirations.back().second);
+	}
+
+	// The messages may have been deleted meanwhile, or their chat room may be gone.
+	list<shared_ptr<EventLog>> expiredEvents;
+	if (!expiredStorageIds.empty()) {
+		for (const auto &event : mainDb->getEvents(expiredStorageIds)) {
+			if (event->getType() != EventLog::Type::ConferenceChatMessage) continue;
+			if (!static_pointer_cast<ConferenceChatMessageEvent>(event)->getChatMessage()->getChatRoom()) continue;
+			expiredEvents.push_back(event);
+		}
+	}
+
+	if (!expiredEvents.empty() && !mainDb->deleteEvents(expiredEvents)) {
+		// Keep the messages in the heap so that their deletion is retried a bit later.
+		lWarning() << "[Ephemeral] Unable to delete " << expiredEvents.size() << " message(s) from database";
+		for (const auto &expiration : expirations)
+			ephemeralMessages.push(expiration);
+		startEphemeralMessageTimer(currentTime + 1);
+		return;
+	}
+
+	if (!expiredEvents.empty()) {
+		lInfo() << "[Ephemeral] " << expiredEvents.size() << " message(s) deleted from database";
+		for (const auto &event : expiredEvents) {
+			shared_ptr<ChatMessage> msg = static_pointer_cast<ConferenceChatMessageEvent>(event)->getChatMessage();
 			shared_ptr<AbstractChatRoom> chatRoom = msg->getChatRoom();
-			if (chatRoom && event) {
-				LinphonePrivate::EventLog::deleteFromDatabase(event);
-				lInfo() << "[Ephemeral] Message deleted from database";
-
-				// Notify ephemeral message deleted to message if exists.
-				LinphoneChatMessage *message = L_GET_C_BACK_PTR(msg.get());
-				if (message) {
-					LinphoneChatMessageCbs *cbs = linphone_chat_message_get_callbacks(message);
-					if (cbs && linphone_chat_message_cbs_get_ephemeral_message_deleted(cbs)) {
-						linphone_chat_message_cbs_get_ephemeral_message_deleted(cbs)(message);
-					}
-					_linphone_chat_message_notify_ephemeral_message_deleted(message);
+			if (!chatRoom) continue;
+
+			// Notify ephemeral message deleted to message if exists.
+			LinphoneChatMessage *message = L_GET_C_BACK_PTR(msg.get());
+			if (message) {
+				LinphoneChatMessageCbs *cbs = linphone_chat_message_get_callbacks(message);
+				if (cbs && linphone_chat_message_cbs_get_ephemeral_message_deleted(cbs)) {
+					linphone_chat_message_cbs_get_ephemeral_message_deleted(cbs)(message);
 				}
-
-				// Notify ephemeral message deleted to chat room & core.
-				LinphoneChatRoom *cr = L_GET_C_BACK_PTR(chatRoom);
-				_linphone_chat_room_notify_ephemeral_message_deleted(cr, L_GET_C_BACK_PTR(event));
-				linphone_core_notify_chat_room_ephemeral_message_deleted(linphone_chat_room_get_core(cr), cr);
+				_linphone_chat_message_notify_ephemeral_message_deleted(message);
 			}
 
-			// Delete message from this list even when chatroom is gone.
-			ephemeralMessages.pop_front();
-			handleEphemeralMessages(currentTime);
-		} else {
-			startEphemeralMessageTimer(expireTime);
+			// Notify ephemeral message deleted to chat room & core.
+			LinphoneChatRoom *cr = L_GET_C_BACK_PTR(chatRoom);
+			_linphone_chat_room_notify_ephemeral_message_deleted(cr, L_GET_C_BACK_PTR(event));
+			linphone_core_notify_chat_room_ephemeral_message_deleted(linphone_chat_room_get_core(cr), cr);
 		}
-	} else {
-		initEphemeralMessages();
 	}
+
+	if (!ephemeralMessages.empty()) startEphemeralMessageTimer(ephemeralMessages.top().first);
 }
 
 void CorePrivate::initEphemeralMessages() {
 	L_Q();
 	if (mainDb && mainDb->isInitialized()) {
-		ephemeralMessages.clear();
-		ephemeralMessages = mainDb->getEphemeralMessages();
+		// Only the expire times are loaded, messages are retrieved from database when they expire.
+		vector<EphemeralMessageExpiration> expirations;
+		for (const auto &expireTime : mainDb->getEphemeralMessageExpireTimes())
+			expirations.emplace_back(expireTime.second, expireTime.first);
+		ephemeralMessages = decltype(ephemeralMessages)(greater<EphemeralMessageExpiration>(), std::move(expirations));
 		if (!ephemeralMessages.empty()) {
-			lInfo() << "[Ephemeral] list initiated on core " << linphone_core_get_identity(q->getCCore());
-			shared_ptr<ChatMessage> msg = ephemeralMessages.front();
-			startEphemeralMessageTimer(msg->getEphemeralExpireTime());
+			lInfo() << "[Ephemeral] list initiated with " << ephemeralMessages.size() << " message(s) on core "
+			        << linphone_core_get_identity(q->getCCore());
+			startEphemeralMessageTimer(ephemeralMessages.top().first);
 		}
 	}
 }
 
 void CorePrivate::updateEphemeralMessages(const shared_ptr<ChatMessage> &message) {
-	if (ephemeralMessages.empty()) {
-		// Can not determine this message will expire most quickly, so init this list.
-		initEphemeralMessages();
-	} else {
-		shared_ptr<ChatMessage> lastmsg = ephemeralMessages.back();
-		if (lastmsg->getEphemeralLifetime() < message->getEphemeralLifetime()) {
-			// The last message of this list will expire more quickly than this message, can not determine this message
-			// will expire most quickly in the remaining messages.
-			return;
-		}
-		for (std::list<shared_ptr<ChatMessage>>::iterator it = ephemeralMessages.begin(); it != ephemeralMessages.end();
-		     ++it) {
-			shared_ptr<ChatMessage> msg = *it;
-			if (msg->getEphemeralExpireTime() > message->getEphemeralExpireTime()) {
-				// This message will expire more quickly than the last message of this list, add it.
-				if (it == ephemeralMessages.begin()) {
-					ephemeralMessages.push_front(message);
-					startEphemeralMessageTimer(message->getEphemeralExpireTime());
-				} else {
-					it = --it;
-					ephemeralMessages.insert(it, message);
-				}
-				return;
-			}
-		}
-	}
+	const time_t expireTime = message->getEphemeralExpireTime();
+	const bool expiresFirst = ephemeralMessages.empty() || (expireTime < ephemeralMessages.top().first);
+	ephemeralMessages.emplace(expireTime, message->getStorageId());
+	if (expiresFirst) startEphemeralMessageTimer(expireTime);
 }
 
 void CorePrivate::sendDeliveryNotifications() {
@@ -551,6 +604,13 @@ void CorePrivate::replaceChatRoom(const shared_ptr<AbstractChatRoom> &replacedCh
 		chatRoomsById.erase(replacedConferenceId);
 		chatRoomsById[newConferenceId] = newChatRoom;
 	}
+	notifyChatRoomDeletedToEncryptionEngine(replacedConferenceId);
+}
+
+void CorePrivate::notifyChatRoomDeletedToEncryptionEngine(const ConferenceId &conferenceId) {
+	L_Q();
+	EncryptionEngine *imee = q->getEncryptionEngine();
+	if (imee) imee->onChatRoomDeleted(conferenceId);
 }
 
 #ifndef _MSC_VER
@@ -635,6 +695,7 @@ void CorePrivate::updateChatRoomConferenceId(const shared_ptr<AbstractChatRoom>
 
 	chatRoomsById.erase(oldConferenceId);
 	chatRoomsById[newConferenceId] = chatRoom;
+	notifyChatRoomDeletedToEncryptionEngine(oldConferenceId);
 
 	mainDb->updateChatRoomConferenceId(oldConferenceId, newConferenceId);
 #endif
@@ -843,6 +904,7 @@ void Core::deleteChatRoom(const shared_ptr<const AbstractChatRoom> &chatRoom) {
 	auto chatRoomsByIdIt = d->chatRoomsById.find(conferenceId);
 	if (chatRoomsByIdIt != d->chatRoomsById.end()) {
 		d->chatRoomsById.erase(chatRoomsByIdIt);
+		d->notifyChatRoomDeletedToEncryptionEngine(conferenceId);
 		if (d->mainDb->isInitialized()) d->mainDb->deleteChatRoom(conferenceId);
 	} else {
 		lError() << "Unable to delete chat room with conference ID " << conferenceId << " because it cannot be found.";
@@ -958,6 +1020,9 @@ LinphoneReason Core::onSipMessageReceived(SalOp *op, const SalMessage *sal_msg)
 		lInfo() << "Chat message Call-ID matches last push received Call-ID, stopping push background task";
 		d->lastPushReceivedCallId = "";
 		d->pushReceivedBackgroundTask.stop();
+		// The message that woke up the core is handled.
+		d->pushWakeTime = 0;
+		d->doLater([d]() { d->runDeferredStartupTasks(); });
 	}
 
 	return reason;
@@ -21,12 +21,14 @@
 #ifndef _L_CORE_P_H_
 #define _L_CORE_P_H_
 
+#include <queue>
 #include <stdexcept>
 
 #include "linphone/utils/utils.h"
 
 #include "auth-info/auth-stack.h"
 #include "call/audio-device/audio-device.h"
+#include "call/call-registry.h"
 #include "chat/chat-room/abstract-chat-room.h"
 #include "conference/session/tone-manager.h"
 #include "core.h"
@@ -39,8 +41,13 @@
 
 LINPHONE_BEGIN_NAMESPACE
 
+class AccountRegistrationScheduler;
 class CoreListener;
+class QualityReportAggregator;
+class CoreSettings;
 class EncryptionEngine;
+class FileTransferScheduler;
+class RtpPortAllocator;
 class LocalConferenceListEventHandler;
 class RemoteConferenceListEventHandler;
 
@@ -75,12 +82,13 @@ public:
 
 	int addCall(const std::shared_ptr<Call> &call);
 	bool canWeAddCall() const;
+	// To be called when a timeout setting has changed.
+	void updateCallDeadlines();
 	bool hasCalls() const {
 		return !calls.empty();
 	}
 	bool inviteReplacesABrokenCall(SalCallOp *op);
 	bool isAlreadyInCallWithAddress(const std::shared_ptr<Address> &addr) const;
-	void iterateCalls(time_t currentRealTime, bool oneSecondElapsed) const;
 	void notifySoundcardUsage(bool used);
 	int removeCall(const std::shared_ptr<Call> &call);
 	void setCurrentCall(const std::shared_ptr<Call> &call);
@@ -104,6 +112,16 @@ public:
 
 	void reloadLdapList();
 
+	// Runs the startup tasks that are not needed to receive a call or a message, unless the core is woken up by a
+	// push notification: they are then deferred until runDeferredStartupTasks() is called.
+	// The friends database is still read when its path is set, as the caller of an incoming call is looked up in it.
+	// Only the network work of the friend lists, the vCard synchronization and presence subscriptions, is deferred.
+	void runStartupTasks();
+	void runDeferredStartupTasks();
+	bool areStartupTasksDeferred() const {
+		return startupTasksDeferred;
+	}
+
 	// Base
 	std::shared_ptr<AbstractChatRoom> createClientGroupChatRoom(const std::string &subject,
 	                                                            const std::shared_ptr<Address> &conferenceFactoryUri,
@@ -142,6 +160,11 @@ public:
 	                                                 const std::shared_ptr<const Address> &localAddr,
 	                                                 const std::shared_ptr<const Address> &remoteAddr,
 	                                                 const std::list<std::shared_ptr<Address>> &participants) const;
+	// Same as searchChatRoom() for the one-to-one chat room of each participant, in a single pass over the chat rooms.
+	std::list<std::shared_ptr<AbstractChatRoom>>
+	searchOneToOneChatRooms(const std::shared_ptr<ChatRoomParams> &params,
+	                        const std::shared_ptr<const Address> &localAddr,
+	                        const std::list<std::shared_ptr<Address>> &participants) const;
 
 	std::shared_ptr<const Address> getDefaultLocalAddress(const std::shared_ptr<Address> peerAddress,
 	                                                      bool withGruu) const;
@@ -152,6 +175,8 @@ public:
 	                     const std::shared_ptr<AbstractChatRoom> &newChatRoom);
 
 	void updateChatRoomConferenceId(const std::shared_ptr<AbstractChatRoom> &chatRoom, ConferenceId newConferenceId);
+	// Lets the encryption engine drop what it keeps about a chat room that is no longer known under this id.
+	void notifyChatRoomDeletedToEncryptionEngine(const ConferenceId &conferenceId);
 	std::shared_ptr<AbstractChatRoom> findExhumableOneToOneChatRoom(const std::shared_ptr<Address> &localAddress,
 	                                                                const std::shared_ptr<Address> &participantAddress,
 	                                                                bool encrypted) const;
@@ -164,6 +189,11 @@ public:
 	belle_sip_main_loop_t *getMainLoop();
 	bool basicToFlexisipChatroomMigrationEnabled() const;
 	std::unique_ptr<MainDb> mainDb;
+	std::shared_ptr<FileTransferScheduler> fileTransferScheduler;
+	std::shared_ptr<RtpPortAllocator> rtpPortAllocator;
+	std::shared_ptr<AccountRegistrationScheduler> registrationScheduler;
+	std::shared_ptr<QualityReportAggregator> qualityReportAggregator;
+	mutable std::shared_ptr<const CoreSettings> settings;
 #ifdef HAVE_ADVANCED_IM
 	std::unique_ptr<RemoteConferenceListEventHandler> remoteListEventHandler;
 	std::unique_ptr<LocalConferenceListEventHandler> localListEventHandler;
@@ -176,6 +206,7 @@ public:
 
 	void startEphemeralMessageTimer(time_t expireTime);
 	void stopEphemeralMessageTimer();
+	void stopDeferredStartupTimer();
 
 	void computeAudioDevicesList();
 
@@ -191,10 +222,11 @@ public:
 private:
 	bool isInBackground = false;
 	static int ephemeralMessageTimerExpired(void *data, unsigned int revents);
+	static int deferredStartupTimerExpired(void *data, unsigned int revents);
 
 	std::list<CoreListener *> listeners;
 
-	std::list<std::shared_ptr<Call>> calls;
+	CallRegistry calls;
 	std::shared_ptr<Call> currentCall;
 
 	std::unordered_map<ConferenceId, std::shared_ptr<AbstractChatRoom>> chatRoomsById;
@@ -210,7 +242,12 @@ private:
 	std::unordered_map<const AbstractChatRoom *, std::shared_ptr<const AbstractChatRoom>> noCreatedClientGroupChatRooms;
 	AuthStack authStack;
 
-	std::list<std::shared_ptr<ChatMessage>> ephemeralMessages;
+	// Expire time and storage id of the ephemeral messages whose countdown has started, the first to expire on top.
+	using EphemeralMessageExpiration = std::pair<time_t, long long>;
+	std::priority_queue<EphemeralMessageExpiration,
+	                    std::vector<EphemeralMessageExpiration>,
+	                    std::greater<EphemeralMessageExpiration>>
+	    ephemeralMessages;
 	belle_sip_source_t *ephemeralTimer = nullptr;
 
 	belle_sip_source_t *chatMessagesAggregationTimer = nullptr;
@@ -219,6 +256,13 @@ private:
 	BackgroundTask pushReceivedBackgroundTask{"Push received background task"};
 	std::string lastPushReceivedCallId = "";
 
+	// Push wake fast start
+	bool startupTasksDeferred = false;
+	belle_sip_source_t *deferredStartupTimer = nullptr;
+	// Call-ID and reception time of the last push notification, to measure how long it takes to handle it
+	std::string pushWakeCallId;
+	uint64_t pushWakeTime = 0;
+
 	std::list<std::shared_ptr<AudioDevice>> audioDevices;
 	bool stopAsyncEndEnabled = false;
 	ExtraBackgroundTask bgTask{"Stop core async end"};
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2010-2022 Belledonne Communications SARL.
+ *
+ * This file is part of Liblinphone
+ * (see https://gitlab.linphone.org/BC/public/liblinphone).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core-settings.h"
+
+#include "linphone/lpconfig.h"
+#include "private_functions.h"
+
+// =============================================================================
+
+using namespace std;
+
+LINPHONE_BEGIN_NAMESPACE
+
+CoreSettings::CoreSettings(const LinphoneConfig *config) {
+	mConfigRevision = linphone_config_get_revision(config);
+
+	sip.autoAnswerReplacingCalls =
+	    !!linphone_config_get_int(config, "sip", "auto_answer_replacing_calls", sip.autoAnswerReplacingCalls);
+	sip.chatMsgWithContact = !!linphone_config_get_int(config, "sip", "chat_msg_with_contact", sip.chatMsgWithContact);
+	sip.chatUseCallDialogs = !!linphone_config_get_int(config, "sip", "chat_use_call_dialogs", sip.chatUseCallDialogs);
+	sip.cryptoSuiteTagStartingValue =
+	    linphone_config_get_int(config, "sip", "crypto_suite_tag_starting_value", sip.cryptoSuiteTagStartingValue);
+	sip.deferUpdateDefault = !!linphone_config_get_int(config, "sip", "defer_update_default", sip.deferUpdateDefault);
+	sip.deliverImdn = linphone_config_get_int(config, "sip", "deliver_imdn", 0) == 1;
+	sip.inactiveVideoOnPause =
+	    !!linphone_config_get_int(config, "sip", "inactive_video_on_pause", sip.inactiveVideoOnPause);
+	sip.incomingCallsEarlyMedia =
+	    !!linphone_config_get_int(config, "sip", "incoming_calls_early_media", sip.incomingCallsEarlyMedia);
+	sip.keepSrtpKeys = !!linphone_config_get_int(config, "sip", "keep_srtp_keys", sip.keepSrtpKeys);
+	sip.keepSdpVersion = linphone_config_get_int(config, "sip", "keep_sdp_version", sip.keepSdpVersion);
+	sip.repairBrokenCalls = !!linphone_config_get_int(config, "sip", "repair_broken_calls", sip.repairBrokenCalls);
+	sip.retryInviteAfterOfferAnswerFailure = !!linphone_config_get_int(
+	    config, "sip", "retry_invite_after_offeranswer_failure", sip.retryInviteAfterOfferAnswerFailure);
+	sip.sdp200AckFollowVideoPolicy =
+	    !!linphone_config_get_int(config, "sip", "sdp_200_ack_follow_video_policy", sip.sdp200AckFollowVideoPolicy);
+	sip.updateCallWhenIceCompleted =
+	    !!linphone_config_get_int(config, "sip", "update_call_when_ice_completed", sip.updateCallWhenIceCompleted);
+	sip.updateCallWhenIceCompletedWithDtls = !!linphone_config_get_bool(
+	    config, "sip", "update_call_when_ice_completed_with_dtls", sip.updateCallWhenIceCompletedWithDtls);
+
+	rtp.acceptAnyEncryption =
+	    !!linphone_config_get_int(config, "rtp", "accept_any_encryption", rtp.acceptAnyEncryption);
+	rtp.acceptBundle = !!linphone_config_get_bool(config, "rtp", "accept_bundle", rtp.acceptBundle);
+	const char *bindAddress = linphone_config_get_string(config, "rtp", "bind_address", nullptr);
+	rtp.bindAddress = bindAddress ? bindAddress : "";
+	rtp.preferIpv6 = !!linphone_config_get_bool(config, "rtp", "prefer_ipv6", rtp.preferIpv6);
+	rtp.rtcpFbGenericNackEnabled =
+	    !!linphone_config_get_int(config, "rtp", "rtcp_fb_generic_nack_enabled", rtp.rtcpFbGenericNackEnabled);
+	rtp.rtcpFbTmmbrEnabled = !!linphone_config_get_int(config, "rtp", "rtcp_fb_tmmbr_enabled", rtp.rtcpFbTmmbrEnabled);
+	rtp.rtcpMux = !!linphone_config_get_int(config, "rtp", "rtcp_mux", rtp.rtcpMux);
+	rtp.rtcpXrEnabled = !!linphone_config_get_int(config, "rtp", "rtcp_xr_enabled", rtp.rtcpXrEnabled);
+	rtp.rtcpXrRcvrRttMaxSize =
+	    linphone_config_get_int(config, "rtp", "rtcp_xr_rcvr_rtt_max_size", rtp.rtcpXrRcvrRttMaxSize);
+	rtp.rtcpXrRcvrRttMode =
+	    linphone_config_get_string(config, "rtp", "rtcp_xr_rcvr_rtt_mode", rtp.rtcpXrRcvrRttMode.c_str());
+	rtp.rtcpXrStatSummaryEnabled =
+	    !!linphone_config_get_int(config, "rtp", "rtcp_xr_stat_summary_enabled", rtp.rtcpXrStatSummaryEnabled);
+	rtp.rtcpXrVoipMetricsEnabled =
+	    !!linphone_config_get_int(config, "rtp", "rtcp_xr_voip_metrics_enabled", rtp.rtcpXrVoipMetricsEnabled);
+
+	net.dtmfDelayMs = linphone_config_get_int(config, "net", "dtmf_delay_ms", net.dtmfDelayMs);
+	net.recreateSocketsWhenNetworkIsUp = !!linphone_config_get_int(config, "net", "recreate_sockets_when_network_is_up",
+	                                                               net.recreateSocketsWhenNetworkIsUp);
+
+	sound.dcRemoval = linphone_config_get_int(config, "sound", "dc_removal", sound.dcRemoval);
+	sound.elForce = linphone_config_get_float(config, "sound", "el_force", sound.elForce);
+	sound.elSpeed = linphone_config_get_float(config, "sound", "el_speed", sound.elSpeed);
+	sound.elSustain = linphone_config_get_int(config, "sound", "el_sustain", sound.elSustain);
+	sound.elThres = linphone_config_get_float(config, "sound", "el_thres", sound.elThres);
+	sound.elTransmitThres = linphone_config_get_float(config, "sound", "el_transmit_thres", sound.elTransmitThres);
+	sound.ngFloorGain = linphone_config_get_float(config, "sound", "ng_floorgain", sound.ngFloorGain);
+	sound.ngThres = linphone_config_get_float(config, "sound", "ng_thres", sound.ngThres);
+	sound.speakerAgcEnabled = linphone_config_get_int(config, "sound", "speaker_agc_enabled", sound.speakerAgcEnabled);
+
+	misc.conferenceEventLogEnabled =
+	    !!linphone_config_get_bool(config, "misc", "conference_event_log_enabled", misc.conferenceEventLogEnabled);
+	misc.enableSimpleGroupChatMessageState = !!linphone_config_get_bool(
+	    config, "misc", "enable_simple_group_chat_message_state", misc.enableSimpleGroupChatMessageState);
+	misc.noAvpfForAudio = !!linphone_config_get_bool(config, "misc", "no_avpf_for_audio", misc.noAvpfForAudio);
+	misc.storeRttMessages = linphone_config_get_int(config, "misc", "store_rtt_messages", 1) == 1;
+}
+
+bool CoreSettings::isOutdated(const LinphoneConfig *config) const {
+	return linphone_config_get_revision(config) != mConfigRevision;
+}
+
+LINPHONE_END_NAMESPACE
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2010-2022 Belledonne Communications SARL.
+ *
+ * This file is part of Liblinphone
+ * (see https://gitlab.linphone.org/BC/public/liblinphone).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _L_CORE_SETTINGS_H_
+#define _L_CORE_SETTINGS_H_
+
+#include <string>
+
+#include "linphone/types.h"
+#include "linphone/utils/general.h"
+
+// =============================================================================
+
+LINPHONE_BEGIN_NAMESPACE
+
+/*
+ * Typed snapshot of the linphonerc keys read on call and chat hot paths.
+ * Each member is named after its key and holds the value read from the config, or the default value below when the
+ * key is missing. A snapshot is never modified: Core::getSettings() builds a new one when the config has changed.
+ */
+class LINPHONE_PUBLIC CoreSettings {
+public:
+	struct Sip {
+		bool autoAnswerReplacingCalls = true;            // auto_answer_replacing_calls
+		bool chatMsgWithContact = false;                 // chat_msg_with_contact
+		bool chatUseCallDialogs = false;                 // chat_use_call_dialogs
+		int cryptoSuiteTagStartingValue = 1;             // crypto_suite_tag_starting_value
+		bool deferUpdateDefault = false;                 // defer_update_default
+		bool deliverImdn = false;                        // deliver_imdn
+		bool inactiveVideoOnPause = false;               // inactive_video_on_pause
+		bool incomingCallsEarlyMedia = false;            // incoming_calls_early_media
+		bool keepSrtpKeys = true;                        // keep_srtp_keys
+		int keepSdpVersion = -1;                         // keep_sdp_version, -1 when depending on session timers
+		bool repairBrokenCalls = true;                   // repair_broken_calls
+		bool retryInviteAfterOfferAnswerFailure = true;  // retry_invite_after_offeranswer_failure
+		bool sdp200AckFollowVideoPolicy = false;         // sdp_200_ack_follow_video_policy
+		bool updateCallWhenIceCompleted = true;          // update_call_when_ice_completed
+		bool updateCallWhenIceCompletedWithDtls = false; // update_call_when_ice_completed_with_dtls
+	};
+
+	struct Rtp {
+		bool acceptAnyEncryption = false;      // accept_any_encryption
+		bool acceptBundle = true;              // accept_bundle
+		std::string bindAddress;               // bind_address, empty when not set
+		bool preferIpv6 = true;                // prefer_ipv6
+		bool rtcpFbGenericNackEnabled = false; // rtcp_fb_generic_nack_enabled
+		bool rtcpFbTmmbrEnabled = true;        // rtcp_fb_tmmbr_enabled
+		bool rtcpMux = false;                  // rtcp_mux
+		bool rtcpXrEnabled = true;             // rtcp_xr_enabled
+		int rtcpXrRcvrRttMaxSize = 10000;      // rtcp_xr_rcvr_rtt_max_size
+		std::string rtcpXrRcvrRttMode = "all"; // rtcp_xr_rcvr_rtt_mode
+		bool rtcpXrStatSummaryEnabled = true;  // rtcp_xr_stat_summary_enabled
+		bool rtcpXrVoipMetricsEnabled = true;  // rtcp_xr_voip_metrics_enabled
+	};
+
+	struct Net {
+		int dtmfDelayMs = 200;                       // dtmf_delay_ms
+		bool recreateSocketsWhenNetworkIsUp = false; // recreate_sockets_when_network_is_up
+	};
+
+	struct Sound {
+		int dcRemoval = 0;          // dc_removal
+		float elForce = -1;         // el_force
+		float elSpeed = -1;         // el_speed
+		int elSustain = -1;         // el_sustain
+		float elThres = -1;         // el_thres
+		float elTransmitThres = -1; // el_transmit_thres
+		float ngFloorGain = 0;      // ng_floorgain
+		float ngThres = 0.05f;      // ng_thres
+		int speakerAgcEnabled = 0;  // speaker_agc_enabled
+	};
+
+	struct Misc {
+		bool conferenceEventLogEnabled = true;          // conference_event_log_enabled
+		bool enableSimpleGroupChatMessageState = false; // enable_simple_group_chat_message_state
+		bool noAvpfForAudio = false;                    // no_avpf_for_audio
+		bool storeRttMessages = true;                   // store_rtt_messages
+	};
+
+	explicit CoreSettings(const LinphoneConfig *config);
+
+	// Tells whether the config has been modified since this snapshot was built.
+	bool isOutdated(const LinphoneConfig *config) const;
+
+	Sip sip;
+	Rtp rtp;
+	Net net;
+	Sound sound;
+	Misc misc;
+
+private:
+	unsigned int mConfigRevision = 0;
+};
+
+LINPHONE_END_NAMESPACE
+
+#endif // ifndef _L_CORE_SETTINGS_H_
@@ -39,13 +39,16 @@
 #endif
 
 #include "account/account.h"
+#include "account/account-registration-scheduler.h"
 #include "address/address.h"
 #include "call/call.h"
+#include "call/quality-report-aggregator.h"
 #include "chat/encryption/encryption-engine.h"
 #ifdef HAVE_LIME_X3DH
 #include "chat/encryption/lime-x3dh-encryption-engine.h"
 #endif
 #include "chat/encryption/lime-x3dh-server-engine.h"
+#include "chat/modifier/file-transfer-scheduler.h"
 #ifdef HAVE_ADVANCED_IM
 #include "conference/handlers/local-conference-list-event-handler.h"
 #include "conference/handlers/remote-conference-list-event-handler.h"
@@ -53,6 +56,7 @@
 #include "chat/chat-room/chat-room-p.h"
 #include "core/core-listener.h"
 #include "core/core-p.h"
+#include "core/core-settings.h"
 #include "factory/factory.h"
 #include "ldap/ldap.h"
 #include "linphone/lpconfig.h"
@@ -65,6 +69,7 @@
 #include "conference/participant.h"
 #include "conference/session/media-session-p.h"
 #include "conference/session/media-session.h"
+#include "conference/session/rtp-port-allocator.h"
 #include "conference/session/streams.h"
 #include "conference_private.h"
 
@@ -101,6 +106,31 @@ void CorePrivate::init() {
 #endif
 
 	LinphoneCore *lc = L_GET_C_BACK_PTR(q);
+#ifdef __ANDROID__
+	// On Android assume Core has been started in background,
+	// otherwise first notifyEnterForeground() will do nothing.
+	// If not, ActivityMonitor will tell us quickly.
+	isInBackground = true;
+#endif
+	// A core started in background is most likely woken up by a push notification.
+	startupTasksDeferred =
+	    isInBackground && linphone_config_get_bool(lc->config, "misc", "push_wake_fast_start", FALSE);
+	if (startupTasksDeferred) lInfo() << "Core started in background, deferring startup tasks";
+
+	fileTransferScheduler = make_shared<FileTransferScheduler>(
+	    (unsigned int)linphone_config_get_int(lc->config, "misc", "max_parallel_file_uploads", 0),
+	    (unsigned int)linphone_config_get_int(lc->config, "misc", "max_parallel_file_downloads", 0));
+	settings = make_shared<CoreSettings>(lc->config);
+	rtpPortAllocator = make_shared<RtpPortAllocator>();
+	// Registrations are only scheduled when asked to, so that they are sent right away by default.
+	const int maxRegisters = max(0, linphone_config_get_int(lc->config, "sip", "max_concurrent_registers", 0));
+	const int registerSpreadMs = max(0, linphone_config_get_int(lc->config, "sip", "register_spread_ms", 0));
+	registrationScheduler =
+	    (maxRegisters > 0 || registerSpreadMs > 0)
+	        ? make_shared<AccountRegistrationScheduler>((size_t)maxRegisters, (uint64_t)registerSpreadMs)
+	        : nullptr;
+	qualityReportAggregator = make_shared<QualityReportAggregator>(q->getSharedFromThis());
+
 	if (q->limeX3dhAvailable()) {
 		bool limeEnabled = linphone_config_get_bool(lc->config, "lime", "enabled", TRUE);
 		if (limeEnabled) {
@@ -167,13 +197,6 @@ void CorePrivate::init() {
 			} else lWarning() << "ZRTP secrets database explicitely not requested";
 		}
 	}
-
-#ifdef __ANDROID__
-	// On Android assume Core has been started in background,
-	// otherwise first notifyEnterForeground() will do nothing.
-	// If not, ActivityMonitor will tell us quickly.
-	isInBackground = true;
-#endif
 }
 
 void CorePrivate::registerListener(CoreListener *listener) {
@@ -287,7 +310,9 @@ void CorePrivate::shutdown() {
 	if (toneManager) toneManager->freeAudioResources();
 
 	stopEphemeralMessageTimer();
-	ephemeralMessages.clear();
+	ephemeralMessages = decltype(ephemeralMessages)();
+	stopDeferredStartupTimer();
+	startupTasksDeferred = false;
 
 	stopChatMessagesAggregationTimer();
 
@@ -347,6 +372,9 @@ void CorePrivate::uninit() {
 	}
 	q->audioVideoConferenceById.clear();
 
+	// Do not lose the quality reports that are waiting to be aggregated.
+	if (qualityReportAggregator) qualityReportAggregator->flush();
+
 	noCreatedClientGroupChatRooms.clear();
 	listeners.clear();
 	pushReceivedBackgroundTask.stop();
@@ -388,6 +416,23 @@ void CorePrivate::notifyNetworkReachable(bool sipNetworkReachable, bool mediaNet
 }
 
 void CorePrivate::notifyCallStateChanged(LinphoneCall *call, LinphoneCallState state, const string &message) {
+	// The Call-ID and the remote address of a call may change along with its state
+	calls.update(Call::toCpp(call));
+	if (pushWakeTime != 0 && !pushWakeCallId.empty()) {
+		auto callLog = Call::toCpp(call)->getLog();
+		if (callLog && callLog->getCallId() == pushWakeCallId) {
+			uint64_t elapsed = bctbx_get_cur_time_ms() - pushWakeTime;
+			if (state == LinphoneCallIncomingReceived) {
+				lInfo() << "[Push] INVITE received " << elapsed << " ms after push notification";
+			} else if (state == LinphoneCallConnected || state == LinphoneCallEnd || state == LinphoneCallError) {
+				if (state == LinphoneCallConnected)
+					lInfo() << "[Push] Call answered " << elapsed << " ms after push notification";
+				pushWakeTime = 0;
+				// The call that woke up the core is handled.
+				doLater([this]() { runDeferredStartupTasks(); });
+			}
+		}
+	}
 	auto listenersCopy = listeners; // Allow removal of a listener in its own call
 	for (const auto &listener : listenersCopy)
 		listener->onCallStateChanged(call, state, message);
@@ -396,6 +441,10 @@ void CorePrivate::notifyCallStateChanged(LinphoneCall *call, LinphoneCallState s
 void CorePrivate::notifyRegistrationStateChanged(LinphoneProxyConfig *cfg,
                                                  LinphoneRegistrationState state,
                                                  const string &message) {
+	if (pushWakeTime != 0 && state == LinphoneRegistrationOk) {
+		lInfo() << "[Push] Account [" << linphone_proxy_config_get_identity(cfg) << "] registered "
+		        << (bctbx_get_cur_time_ms() - pushWakeTime) << " ms after push notification";
+	}
 	auto listenersCopy = listeners; // Allow removal of a listener in its own call
 	for (const auto &listener : listenersCopy)
 		listener->onRegistrationStateChanged(cfg, state, message);
@@ -447,6 +496,9 @@ void CorePrivate::notifyEnteringForeground() {
 	for (const auto &listener : listenersCopy)
 		listener->onEnteringForeground();
 
+	pushWakeTime = 0;
+	runDeferredStartupTasks();
+
 	if (q->isFriendListSubscriptionEnabled()) enableFriendListsSubscription(true);
 }
 
@@ -511,6 +563,52 @@ void CorePrivate::startEphemeralMessageTimer(time_t expireTime) {
 	}
 }
 
+void CorePrivate::runStartupTasks() {
+	LinphoneCore *lc = getCCore();
+	if (startupTasksDeferred) {
+		// Whatever happens, the push notification window is over after this delay.
+		int delay = linphone_config_get_int(lc->config, "misc", "push_wake_deferred_tasks_delay", 20);
+		lInfo() << "Startup tasks deferred for at most " << delay << " seconds";
+		stopDeferredStartupTimer();
+		deferredStartupTimer =
+		    lc->sal->createTimer(deferredStartupTimerExpired, this, (unsigned int)delay * 1000, "deferred startup");
+		return;
+	}
+
+	initEphemeralMessages();
+	reloadLdapList();
+	if (lc->base_contacts_list_for_synchronization)
+		linphone_friend_list_synchronize_friends_from_server(lc->base_contacts_list_for_synchronization);
+}
+
+void CorePrivate::runDeferredStartupTasks() {
+	if (!startupTasksDeferred) return;
+
+	lInfo() << "Running deferred startup tasks";
+	startupTasksDeferred = false;
+	stopDeferredStartupTimer();
+	runStartupTasks();
+	// Not sent by loadChatRooms() to leave the network to the registration.
+	if (mainDb && mainDb->isInitialized()) sendDeliveryNotifications();
+	// Not sent on registration for the same reason.
+	linphone_core_update_friends_subscriptions(getCCore());
+}
+
+int CorePrivate::deferredStartupTimerExpired(void *data, BCTBX_UNUSED(unsigned int revents)) {
+	CorePrivate *d = static_cast<CorePrivate *>(data);
+	d->runDeferredStartupTasks();
+	return BELLE_SIP_STOP;
+}
+
+void CorePrivate::stopDeferredStartupTimer() {
+	if (deferredStartupTimer) {
+		auto core = getPublic()->getCCore();
+		if (core && core->sal) core->sal->cancelTimer(deferredStartupTimer);
+		belle_sip_object_unref(deferredStartupTimer);
+		deferredStartupTimer = nullptr;
+	}
+}
+
 void CorePrivate::stopEphemeralMessageTimer() {
 	if (ephemeralTimer) {
 		auto core = getPublic()->getCCore();
@@ -636,6 +734,13 @@ LinphoneCore *Core::getCCore() const {
 	return L_GET_C_BACK_PTR(this);
 }
 
+shared_ptr<const CoreSettings> Core::getSettings() const {
+	L_D();
+	const LinphoneConfig *config = linphone_core_get_config(getCCore());
+	if (!d->settings || d->settings->isOutdated(config)) d->settings = make_shared<CoreSettings>(config);
+	return d->settings;
+}
+
 // -----------------------------------------------------------------------------
 // Paths.
 // -----------------------------------------------------------------------------
@@ -1195,6 +1300,8 @@ void Core::pushNotificationReceived(const string &callId, const string &payload,
 	L_D();
 
 	lInfo() << "Push notification received for Call-ID [" << callId << "]";
+	d->pushWakeCallId = callId;
+	d->pushWakeTime = bctbx_get_cur_time_ms();
 	// Stop any previous background task we might already have
 	d->pushReceivedBackgroundTask.stop();
 
@@ -1222,6 +1329,10 @@ void Core::pushNotificationReceived(const string &callId, const string &payload,
 			d->lastPushReceivedCallId = callId;
 			// Start a background task for 20 seconds to ensure we have time to process the push
 			d->pushReceivedBackgroundTask.start(getSharedFromThis(), 20);
+		} else {
+			// Nothing left to wait for.
+			d->pushWakeTime = 0;
+			d->doLater([d]() { d->runDeferredStartupTasks(); });
 		}
 	}
 
@@ -60,6 +60,7 @@ class ConferenceInfo;
 class Participant;
 class ConferenceParams;
 class CorePrivate;
+class CoreSettings;
 class EncryptionEngine;
 class ChatMessage;
 class ChatRoom;
@@ -89,12 +90,14 @@ class LINPHONE_PUBLIC Core : public Object {
 	friend class ClientGroupChatRoom;
 	friend class ClientGroupChatRoomPrivate;
 	friend class ClientGroupToBasicChatRoomPrivate;
+	friend class FileTransferChatMessageModifier;
 	friend class Imdn;
 	friend class LocalConferenceEventHandler;
 	friend class LocalConference;
 	friend class MainDb;
 	friend class MainDbEventKey;
 	friend class MS2Stream;
+	friend class Stream;
 	friend class MediaSessionPrivate;
 	friend class RemoteConferenceEventHandler;
 	friend class RemoteConferenceListEventHandler;
@@ -144,6 +147,9 @@ public:
 	// TODO: Remove me later.
 	LinphoneCore *getCCore() const;
 
+	// Returns the typed snapshot of the settings read on call and chat paths, rebuilt if the config has changed since.
+	std::shared_ptr<const CoreSettings> getSettings() const;
+
 	// ---------------------------------------------------------------------------
 	// Call.
 	// ---------------------------------------------------------------------------
@@ -101,7 +101,6 @@ constexpr const char *select[SelectCount] = {
 			LEFT JOIN sip_address AS device_sip_address ON device_sip_address.id = device_sip_address_id
 			LEFT JOIN sip_address AS participant_sip_address ON participant_sip_address.id = participant_sip_address_id
 			LEFT JOIN sip_address AS reply_sender_address ON reply_sender_address.id = reply_sender_address_id
-			WHERE conference_event_view.id = :1
 		)",
 
     /* SelectConferenceEvents */ R"(
@@ -137,6 +136,17 @@ constexpr const char *select[SelectCount] = {
 			SELECT id
 			FROM conference_call
 			WHERE call_id = :1
+		)",
+
+    /* SelectChatMessageEventsFromCallId */ R"(
+			SELECT conference_event_view.id AS event_id, type, creation_time, from_sip_address.value, to_sip_address.value, time, imdn_message_id, state, direction, is_secured, notify_id, device_sip_address.value, participant_sip_address.value, subject, delivery_notification_required, display_notification_required, security_alert, faulty_device, marked_as_read, forward_info, ephemeral_lifetime, expired_time, lifetime, reply_message_id, reply_sender_address.value, chat_room_id
+			FROM conference_event_view
+			LEFT JOIN sip_address AS from_sip_address ON from_sip_address.id = from_sip_address_id
+			LEFT JOIN sip_address AS to_sip_address ON to_sip_address.id = to_sip_address_id
+			LEFT JOIN sip_address AS device_sip_address ON device_sip_address.id = device_sip_address_id
+			LEFT JOIN sip_address AS participant_sip_address ON participant_sip_address.id = participant_sip_address_id
+			LEFT JOIN sip_address AS reply_sender_address ON reply_sender_address.id = reply_sender_address_id
+			WHERE call_id = :1
 		)"};
 
 // ---------------------------------------------------------------------------
@@ -39,13 +39,14 @@ enum Select {
 	SelectConferenceInfoParticipantId,
 	SelectConferenceInfoOrganizerId,
 	SelectConferenceCall,
+	SelectChatMessageEventsFromCallId,
 	SelectCount
 };
 
 enum Insert { InsertOneToOneChatRoom, InsertCount };
 
-const char *get(Select selectStmt);
-const char *get(Insert insertStmt, AbstractDb::Backend backend);
+LINPHONE_INTERNAL_PUBLIC const char *get(Select selectStmt);
+LINPHONE_INTERNAL_PUBLIC const char *get(Insert insertStmt, AbstractDb::Backend backend);
 } // namespace Statements
 
 LINPHONE_END_NAMESPACE
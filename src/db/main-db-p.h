@@ -206,6 +206,8 @@ private:
 	ConferenceId getConferenceIdFromCache(long long storageId) const;
 	std::shared_ptr<CallLog> getCallLogFromCache(long long storageId) const;
 	std::shared_ptr<ConferenceInfo> getConferenceInfoFromCache(long long storageId) const;
+	// Returns -1 if the call log is neither stored nor read from the database.
+	long long getCallLogStorageId(const std::shared_ptr<CallLog> &callLog) const;
 
 	void invalidConferenceEventsFromQuery(const std::string &query, long long chatRoomId);
 
@@ -29,6 +29,8 @@
 #endif
 
 #include <ctime>
+#include <limits>
+#include <unordered_set>
 
 #include <bctoolbox/defs.h>
 
@@ -71,7 +73,7 @@ LINPHONE_BEGIN_NAMESPACE
 
 #ifdef HAVE_DB_STORAGE
 namespace {
-constexpr unsigned int ModuleVersionEvents = makeVersion(1, 0, 20);
+constexpr unsigned int ModuleVersionEvents = makeVersion(1, 0, 22);
 constexpr unsigned int ModuleVersionFriends = makeVersion(1, 0, 0);
 constexpr unsigned int ModuleVersionLegacyFriendsImport = makeVersion(1, 0, 0);
 constexpr unsigned int ModuleVersionLegacyHistoryImport = makeVersion(1, 0, 0);
@@ -1950,6 +1952,16 @@ void MainDbPrivate::cache(const std::shared_ptr<CallLog> &callLog, long long sto
 #endif
 }
 
+long long MainDbPrivate::getCallLogStorageId(const std::shared_ptr<CallLog> &callLog) const {
+#ifdef HAVE_DB_STORAGE
+	// Every call log read from or written to the database goes through the cache.
+	for (const auto &entry : storageIdToCallLog) {
+		if (entry.second.lock() == callLog) return entry.first;
+	}
+#endif
+	return -1;
+}
+
 void MainDbPrivate::cache(const std::shared_ptr<ConferenceInfo> &conferenceInfo, long long storageId) const {
 #ifdef HAVE_DB_STORAGE
 	storageIdToConferenceInfo[storageId] = conferenceInfo;
@@ -2252,6 +2264,23 @@ void MainDbPrivate::updateSchema() {
 		*session << "ALTER TABLE conference_info_participant ADD COLUMN params VARCHAR(2048) DEFAULT ''";
 	}
 
+	if (version < makeVersion(1, 0, 21)) {
+		// Every push notification looks for messages by call id and every IMDN by message id.
+		// On mysql, only a prefix of these varchar(255) columns can be indexed with charset utf8mb4.
+		const string prefix = backend == MainDb::Backend::Mysql ? "(191)" : "";
+		*session << "CREATE INDEX chat_message_call_id_index ON conference_chat_message_event (call_id" + prefix +
+		                ")";
+		*session << "CREATE INDEX chat_message_imdn_message_id_index ON conference_chat_message_event "
+		            "(imdn_message_id" +
+		                prefix + ")";
+		*session << "CREATE INDEX conference_call_call_id_index ON conference_call (call_id)";
+	}
+
+	if (version < makeVersion(1, 0, 22)) {
+		// Call history pages are read in this order.
+		*session << "CREATE INDEX conference_call_start_time_index ON conference_call (start_time, id)";
+	}
+
 	// /!\ Warning : if varchar columns < 255 were to be indexed, their size must be set back to 191 = max indexable
 	// (KEY or UNIQUE) varchar size for mysql < 5.7 with charset utf8mb4 (both here and in column creation)
 
@@ -3462,9 +3491,86 @@ bool MainDb::deleteEvent(const shared_ptr<const EventLog> &eventLog) {
 		if (eventLog->getType() == EventLog::Type::ConferenceChatMessage) {
 			shared_ptr<ChatMessage> chatMessage(
 			    static_pointer_cast<const ConferenceChatMessageEvent>(eventLog)->getChatMessage());
-			if (chatMessage->getDirection() == ChatMessage::Direction::Incoming &&
+			shared_ptr<AbstractChatRoom> chatRoom = chatMessage->getChatRoom();
+			if (chatRoom && chatMessage->getDirection() == ChatMessage::Direction::Incoming &&
 			    !chatMessage->getPrivate()->isMarkedAsRead()) {
-				int *count = d->unreadChatMessageCountCache[chatMessage->getChatRoom()->getConferenceId()];
+				int *count = d->unreadChatMessageCountCache[chatRoom->getConferenceId()];
+				if (count) --*count;
+			}
+		}
+
+		return true;
+	};
+#else
+	return false;
+#endif
+}
+
+bool MainDb::deleteEvents(const list<shared_ptr<EventLog>> &eventLogs) {
+#ifdef HAVE_DB_STORAGE
+	// Delete by chunks to stay far below the maximum length of a statement.
+	static constexpr size_t maxIdsPerStatement = 500;
+
+	list<shared_ptr<EventLog>> validEventLogs;
+	for (const auto &eventLog : eventLogs) {
+		if (eventLog->getPrivate()->dbKey.isValid()) {
+			validEventLogs.push_back(eventLog);
+		} else {
+			lWarning() << "Unable to delete invalid event.";
+		}
+	}
+	if (validEventLogs.empty()) return false;
+
+	return L_DB_TRANSACTION {
+		L_D();
+		soci::session *session = d->dbSession.getBackendSession();
+
+		unordered_set<shared_ptr<AbstractChatRoom>> chatRooms;
+		ostringstream ids;
+		size_t idCount = 0;
+		for (const auto &eventLog : validEventLogs) {
+			const long long &storageId =
+			    static_cast<MainDbKey &>(eventLog->getPrivate()->dbKey).getPrivate()->storageId;
+			ids << (idCount == 0 ? "" : ",") << storageId;
+			if (++idCount == maxIdsPerStatement) {
+				*session << "DELETE FROM event WHERE id IN (" + ids.str() + ")";
+				ids.str("");
+				idCount = 0;
+			}
+
+			if (eventLog->getType() == EventLog::Type::ConferenceChatMessage) {
+				shared_ptr<AbstractChatRoom> chatRoom =
+				    static_pointer_cast<ConferenceChatMessageEvent>(eventLog)->getChatMessage()->getChatRoom();
+				if (chatRoom) chatRooms.insert(chatRoom);
+			}
+		}
+		if (idCount > 0) *session << "DELETE FROM event WHERE id IN (" + ids.str() + ")";
+
+		// The last message of a chat room is looked for once, whatever the number of its deleted messages.
+		for (const auto &chatRoom : chatRooms) {
+			const long long &dbChatRoomId = d->selectChatRoomId(chatRoom->getConferenceId());
+			*session << "UPDATE chat_room SET last_message_id = IFNULL((SELECT id FROM conference_event_simple_view "
+			            "WHERE chat_room_id = chat_room.id AND type = "
+			         << mapEventFilterToSql(ConferenceChatMessageFilter)
+			         << " ORDER BY id DESC LIMIT 1), 0) WHERE id = :1",
+			    soci::use(dbChatRoomId);
+		}
+
+		tr.commit();
+
+		for (const auto &eventLog : validEventLogs) {
+			// Reset storage ID as event is not valid anymore
+			eventLog->getPrivate()->resetStorageId();
+			if (eventLog->getType() != EventLog::Type::ConferenceChatMessage) continue;
+
+			shared_ptr<ChatMessage> chatMessage(
+			    static_pointer_cast<ConferenceChatMessageEvent>(eventLog)->getChatMessage());
+			// Delete chat message from cache as the event is deleted
+			chatMessage->getPrivate()->resetStorageId();
+			shared_ptr<AbstractChatRoom> chatRoom = chatMessage->getChatRoom();
+			if (chatRoom && chatMessage->getDirection() == ChatMessage::Direction::Incoming &&
+			    !chatMessage->getPrivate()->isMarkedAsRead()) {
+				int *count = d->unreadChatMessageCountCache[chatRoom->getConferenceId()];
 				if (count) --*count;
 			}
 		}
@@ -3512,8 +3618,9 @@ shared_ptr<EventLog> MainDb::getEvent(const unique_ptr<MainDb> &mainDb, const lo
 	return L_DB_TRANSACTION_C(mainDb.get()) {
 		// TODO: Improve. Deal with all events in the future.
 		soci::row row;
-		*d->dbSession.getBackendSession() << Statements::get(Statements::SelectConferenceEvent), soci::into(row),
-		    soci::use(storageId);
+		*d->dbSession.getBackendSession()
+		    << Statements::get(Statements::SelectConferenceEvent) + string(" WHERE conference_event_view.id = :1"),
+		    soci::into(row), soci::use(storageId);
 
 		ConferenceId conferenceId(Address::create(row.get<string>(16))->getSharedFromThis(),
 		                          Address::create(row.get<string>(17)));
@@ -3527,6 +3634,66 @@ shared_ptr<EventLog> MainDb::getEvent(const unique_ptr<MainDb> &mainDb, const lo
 #endif
 }
 
+list<shared_ptr<EventLog>> MainDb::getEvents(const list<long long> &storageIds) {
+#ifdef HAVE_DB_STORAGE
+	// Select by chunks to stay far below the maximum length of a statement.
+	static constexpr size_t maxIdsPerStatement = 500;
+
+	L_D();
+
+	list<shared_ptr<EventLog>> events;
+	list<long long> uncachedStorageIds;
+	for (const auto &storageId : storageIds) {
+		if (storageId < 0) continue;
+		shared_ptr<EventLog> event = d->getEventFromCache(storageId);
+		if (event) events.push_back(event);
+		else uncachedStorageIds.push_back(storageId);
+	}
+	if (uncachedStorageIds.empty()) return events;
+
+	list<shared_ptr<EventLog>> selectedEvents = L_DB_TRANSACTION {
+		soci::session *session = d->dbSession.getBackendSession();
+
+		list<shared_ptr<EventLog>> selected;
+
+		auto selectEvents = [&](const string &ids) {
+			soci::rowset<soci::row> rows =
+			    (session->prepare << Statements::get(Statements::SelectConferenceEvent) +
+			                             string(" WHERE conference_event_view.id IN (") + ids + ")");
+			for (const auto &row : rows) {
+				ConferenceId conferenceId(Address::create(row.get<string>(16))->getSharedFromThis(),
+				                          Address::create(row.get<string>(17)));
+				shared_ptr<AbstractChatRoom> chatRoom = d->findChatRoom(conferenceId);
+				if (!chatRoom) continue;
+
+				shared_ptr<EventLog> event = d->selectGenericConferenceEvent(chatRoom, row);
+				if (event) selected.push_back(event);
+			}
+		};
+
+		ostringstream ids;
+		size_t idCount = 0;
+		for (const auto &storageId : uncachedStorageIds) {
+			ids << (idCount == 0 ? "" : ",") << storageId;
+			if (++idCount == maxIdsPerStatement) {
+				selectEvents(ids.str());
+				ids.str("");
+				idCount = 0;
+			}
+		}
+		if (idCount > 0) selectEvents(ids.str());
+
+		tr.commit();
+		return selected;
+	};
+	events.splice(events.end(), selectedEvents);
+
+	return events;
+#else
+	return list<shared_ptr<EventLog>>();
+#endif
+}
+
 shared_ptr<EventLog> MainDb::getEventFromKey(const MainDbKey &dbKey) {
 #ifdef HAVE_DB_STORAGE
 	if (!dbKey.isValid()) {
@@ -3763,60 +3930,22 @@ list<shared_ptr<ChatMessage>> MainDb::getUnreadChatMessages(const ConferenceId &
 #endif
 }
 
-list<shared_ptr<ChatMessage>> MainDb::getEphemeralMessages() const {
+list<pair<long long, time_t>> MainDb::getEphemeralMessageExpireTimes() const {
 #ifdef HAVE_DB_STORAGE
-	// Keep chat_room_id at the end of the query !!!
-	string query =
-	    "SELECT conference_event_view.id, type, creation_time, from_sip_address.value, to_sip_address.value, time, "
-	    "imdn_message_id, state, direction, is_secured, notify_id, device_sip_address.value, "
-	    "participant_sip_address.value, subject, delivery_notification_required, display_notification_required, "
-	    "security_alert, faulty_device, marked_as_read, forward_info, ephemeral_lifetime, expired_time, lifetime, "
-	    "reply_message_id, reply_sender_address.value, chat_room_id"
-	    " FROM conference_event_view"
-	    " LEFT JOIN sip_address AS from_sip_address ON from_sip_address.id = from_sip_address_id"
-	    " LEFT JOIN sip_address AS to_sip_address ON to_sip_address.id = to_sip_address_id"
-	    " LEFT JOIN sip_address AS device_sip_address ON device_sip_address.id = device_sip_address_id"
-	    " LEFT JOIN sip_address AS participant_sip_address ON participant_sip_address.id = participant_sip_address_id"
-	    " LEFT JOIN sip_address AS reply_sender_address ON reply_sender_address.id = reply_sender_address_id"
-	    " WHERE conference_event_view.id in ("
-	    " SELECT event_id"
-	    " FROM chat_message_ephemeral_event"
-	    " WHERE expired_time > :nullTime"
-	    " ORDER BY expired_time ASC";
-	query += getBackend() == MainDb::Backend::Sqlite3 ? " LIMIT :maxMessages) ORDER BY expired_time ASC"
-	                                                  : " ) ORDER BY expired_time ASC";
+	static const string query = "SELECT event_id, expired_time FROM chat_message_ephemeral_event"
+	                            "  WHERE expired_time > :nullTime";
 
 	return L_DB_TRANSACTION {
 		L_D();
-		list<shared_ptr<ChatMessage>> chatMessages;
+		list<pair<long long, time_t>> expireTimes;
 		soci::rowset<soci::row> rows =
-		    getBackend() == MainDb::Backend::Sqlite3
-		        ? (d->dbSession.getBackendSession()->prepare << query, soci::use(Utils::getTimeTAsTm(0)),
-		           soci::use(EPHEMERAL_MESSAGE_TASKS_MAX_NB))
-		        : (d->dbSession.getBackendSession()->prepare << query, soci::use(Utils::getTimeTAsTm(0)));
-		for (const auto &row : rows) {
-			const long long &dbChatRoomId = d->dbSession.resolveId(row, (int)row.size() - 1);
-			ConferenceId conferenceId = d->getConferenceIdFromCache(dbChatRoomId);
-			if (!conferenceId.isValid()) {
-				conferenceId = d->selectConferenceId(dbChatRoomId);
-			}
-
-			if (conferenceId.isValid()) {
-				shared_ptr<AbstractChatRoom> chatRoom = d->findChatRoom(conferenceId);
-				if (chatRoom) {
-					shared_ptr<EventLog> event = d->selectGenericConferenceEvent(chatRoom, row);
-					if (event) {
-						L_ASSERT(event->getType() == EventLog::Type::ConferenceChatMessage);
-						chatMessages.push_back(
-						    static_pointer_cast<ConferenceChatMessageEvent>(event)->getChatMessage());
-					}
-				}
-			}
-		}
-		return chatMessages;
+		    (d->dbSession.getBackendSession()->prepare << query, soci::use(Utils::getTimeTAsTm(0)));
+		for (const auto &row : rows)
+			expireTimes.emplace_back(d->dbSession.resolveId(row, 0), d->dbSession.getTime(row, 1));
+		return expireTimes;
 	};
 #else
-	return list<shared_ptr<ChatMessage>>();
+	return list<pair<long long, time_t>>();
 #endif
 }
 
@@ -4069,19 +4198,7 @@ list<shared_ptr<ChatMessage>> MainDb::findChatMessages(const ConferenceId &confe
 list<shared_ptr<ChatMessage>> MainDb::findChatMessagesFromCallId(const std::string &callId) const {
 #ifdef HAVE_DB_STORAGE
 	// Keep chat_room_id at the end of the query !!!
-	static const string query =
-	    "SELECT conference_event_view.id AS event_id, type, creation_time, from_sip_address.value, "
-	    "to_sip_address.value, time, imdn_message_id, state, direction, is_secured, notify_id, "
-	    "device_sip_address.value, participant_sip_address.value, subject, delivery_notification_required, "
-	    "display_notification_required, security_alert, faulty_device, marked_as_read, forward_info, "
-	    "ephemeral_lifetime, expired_time, lifetime, reply_message_id, reply_sender_address.value, chat_room_id"
-	    " FROM conference_event_view"
-	    " LEFT JOIN sip_address AS from_sip_address ON from_sip_address.id = from_sip_address_id"
-	    " LEFT JOIN sip_address AS to_sip_address ON to_sip_address.id = to_sip_address_id"
-	    " LEFT JOIN sip_address AS device_sip_address ON device_sip_address.id = device_sip_address_id"
-	    " LEFT JOIN sip_address AS participant_sip_address ON participant_sip_address.id = participant_sip_address_id"
-	    " LEFT JOIN sip_address AS reply_sender_address ON reply_sender_address.id = reply_sender_address_id"
-	    " WHERE call_id = :callId";
+	static const string query = Statements::get(Statements::SelectChatMessageEventsFromCallId);
 
 	return L_DB_TRANSACTION {
 		L_D();
@@ -5277,6 +5394,151 @@ MainDb::getCallHistory(const std::shared_ptr<Address> &peer, const std::shared_p
 #endif
 }
 
+std::list<std::shared_ptr<CallLog>> MainDb::getCallHistoryPage(const std::shared_ptr<CallLog> &after, int limit) {
+#ifdef HAVE_DB_STORAGE
+	if (limit == 0) return list<shared_ptr<CallLog>>();
+	string query = "SELECT conference_call.id, from_sip_address.value, from_sip_address.display_name, "
+	               "to_sip_address.value, to_sip_address.display_name,"
+	               "  direction, duration, start_time, connected_time, status, video_enabled, quality, call_id, "
+	               "refkey, conference_info_id"
+	               " FROM conference_call, sip_address AS from_sip_address, sip_address AS to_sip_address"
+	               " WHERE conference_call.from_sip_address_id = from_sip_address.id AND "
+	               "conference_call.to_sip_address_id = to_sip_address.id";
+	// Pages follow the start time, the row id orders the calls that started in the same second.
+	if (after)
+		query += "  AND (conference_call.start_time < (SELECT start_time FROM conference_call WHERE id = :afterId)"
+		         "  OR (conference_call.start_time = (SELECT start_time FROM conference_call WHERE id = :sameId)"
+		         "  AND conference_call.id < :lowerId))";
+	query += " ORDER BY conference_call.start_time DESC, conference_call.id DESC";
+
+	if (limit > 0) query += " LIMIT " + to_string(limit);
+
+	DurationLogger durationLogger("Get call history page.");
+
+	return L_DB_TRANSACTION {
+		L_D();
+
+		list<shared_ptr<CallLog>> clList;
+
+		soci::session *session = d->dbSession.getBackendSession();
+
+		// The call id cannot be used as a cursor: it may be empty and is not unique.
+		long long afterId = -1;
+		if (after) {
+			afterId = d->getCallLogStorageId(after);
+			if (afterId < 0) {
+				lWarning() << "Unable to find call log [" << after << "] to get the next page after it";
+				tr.commit();
+				return clList;
+			}
+		}
+
+		if (after) {
+			soci::rowset<soci::row> rows =
+			    (session->prepare << query, soci::use(afterId), soci::use(afterId), soci::use(afterId));
+			for (const auto &row : rows)
+				clList.push_back(d->selectCallLog(row));
+		} else {
+			soci::rowset<soci::row> rows = (session->prepare << query);
+			for (const auto &row : rows)
+				clList.push_back(d->selectCallLog(row));
+		}
+
+		tr.commit();
+
+		return clList;
+	};
+#else
+	return list<shared_ptr<CallLog>>();
+#endif
+}
+
+std::list<MainDb::CallHistorySummary> MainDb::getCallHistorySummaries(const std::shared_ptr<CallLog> &after,
+                                                                     int limit) {
+#ifdef HAVE_DB_STORAGE
+	if (limit == 0) return list<CallHistorySummary>();
+	// The peer is the callee of outgoing calls and the caller of incoming ones.
+	string summariesQuery = "SELECT MAX(id), COUNT(*),"
+	                        "  COUNT(CASE WHEN direction = " +
+	                        to_string(LinphoneCallIncoming) + " AND status = " + to_string(LinphoneCallMissed) +
+	                        " THEN 1 END)"
+	                        " FROM conference_call"
+	                        " GROUP BY CASE WHEN direction = " +
+	                        to_string(LinphoneCallOutgoing) +
+	                        " THEN to_sip_address_id ELSE from_sip_address_id END"
+	                        " HAVING MAX(id) < :afterId"
+	                        " ORDER BY MAX(id) DESC";
+
+	if (limit > 0) summariesQuery += " LIMIT " + to_string(limit);
+
+	DurationLogger durationLogger("Get call history summaries.");
+
+	return L_DB_TRANSACTION {
+		L_D();
+
+		list<CallHistorySummary> summaries;
+
+		long long afterId = numeric_limits<long long>::max();
+		if (after) {
+			afterId = d->getCallLogStorageId(after);
+			if (afterId < 0) {
+				lWarning() << "Unable to find call log [" << after << "] to get the summaries after it";
+				tr.commit();
+				return summaries;
+			}
+		}
+
+		soci::session *session = d->dbSession.getBackendSession();
+
+		list<long long> lastCallLogIds;
+		unordered_map<long long, CallHistorySummary> summariesById;
+		long long lastCallLogId;
+		int callCount, missedCallCount;
+		soci::statement st = (session->prepare << summariesQuery, soci::use(afterId), soci::into(lastCallLogId),
+		                      soci::into(callCount), soci::into(missedCallCount));
+		st.execute();
+		while (st.fetch()) {
+			lastCallLogIds.push_back(lastCallLogId);
+			CallHistorySummary &summary = summariesById[lastCallLogId];
+			summary.callCount = callCount;
+			summary.missedCallCount = missedCallCount;
+		}
+
+		if (!lastCallLogIds.empty()) {
+			string query =
+			    "SELECT conference_call.id, from_sip_address.value, from_sip_address.display_name, "
+			    "to_sip_address.value, to_sip_address.display_name,"
+			    "  direction, duration, start_time, connected_time, status, video_enabled, quality, call_id, "
+			    "refkey, conference_info_id"
+			    " FROM conference_call, sip_address AS from_sip_address, sip_address AS to_sip_address"
+			    " WHERE conference_call.from_sip_address_id = from_sip_address.id AND "
+			    "conference_call.to_sip_address_id = to_sip_address.id"
+			    "  AND conference_call.id IN (";
+			for (const auto &id : lastCallLogIds) {
+				if (id != lastCallLogIds.front()) query += ",";
+				query += to_string(id);
+			}
+			query += ")";
+
+			soci::rowset<soci::row> rows = (session->prepare << query);
+			for (const auto &row : rows) {
+				summariesById[d->dbSession.resolveId(row, 0)].lastCallLog = d->selectCallLog(row);
+			}
+
+			for (const auto &id : lastCallLogIds) {
+				summaries.push_back(std::move(summariesById[id]));
+			}
+		}
+
+		tr.commit();
+
+		return summaries;
+	};
+#else
+	return list<CallHistorySummary>();
+#endif
+}
+
 std::shared_ptr<CallLog> MainDb::getLastOutgoingCall() {
 #ifdef HAVE_DB_STORAGE
 	static const string query = "SELECT conference_call.id, from_sip_address.value, from_sip_address.display_name, "
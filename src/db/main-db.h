@@ -75,6 +75,13 @@ public:
 		time_t timestamp = 0;
 	};
 
+	// Calls exchanged with one peer: the remote address of the last call log is the peer.
+	struct CallHistorySummary {
+		std::shared_ptr<CallLog> lastCallLog;
+		int callCount = 0;
+		int missedCallCount = 0;
+	};
+
 	MainDb(const std::shared_ptr<Core> &core);
 
 	// ---------------------------------------------------------------------------
@@ -84,10 +91,13 @@ public:
 	bool addEvent(const std::shared_ptr<EventLog> &eventLog);
 	bool updateEvent(const std::shared_ptr<EventLog> &eventLog);
 	static bool deleteEvent(const std::shared_ptr<const EventLog> &eventLog);
+	bool deleteEvents(const std::list<std::shared_ptr<EventLog>> &eventLogs);
 	int getEventCount(FilterMask mask = NoFilter) const;
 
 	static std::shared_ptr<EventLog> getEventFromKey(const MainDbKey &dbKey);
 	static std::shared_ptr<EventLog> getEvent(const std::unique_ptr<MainDb> &mainDb, const long long &storageId);
+	// Events which are not found, or whose chat room is not loaded, are not returned.
+	std::list<std::shared_ptr<EventLog>> getEvents(const std::list<long long> &storageIds);
 
 	// ---------------------------------------------------------------------------
 	// Conference notified events.
@@ -122,7 +132,8 @@ public:
 	                                    ChatMessage::State state,
 	                                    time_t stateChangeTime);
 
-	std::list<std::shared_ptr<ChatMessage>> getEphemeralMessages() const;
+	// Storage ids and expire times of the ephemeral messages whose countdown has started.
+	std::list<std::pair<long long, time_t>> getEphemeralMessageExpireTimes() const;
 
 	bool isChatRoomEmpty(const ConferenceId &conferenceId) const;
 	std::shared_ptr<ChatMessage> getLastChatMessage(const ConferenceId &conferenceId) const;
@@ -220,6 +231,10 @@ public:
 	std::list<std::shared_ptr<CallLog>> getCallHistory(const std::shared_ptr<Address> &address, int limit = -1);
 	std::list<std::shared_ptr<CallLog>>
 	getCallHistory(const std::shared_ptr<Address> &peer, const std::shared_ptr<Address> &local, int limit = -1);
+	// Pages of the history, by decreasing start time. Pass the last call log of the previous page to get the next one.
+	std::list<std::shared_ptr<CallLog>> getCallHistoryPage(const std::shared_ptr<CallLog> &after, int limit);
+	// Summaries are sorted by the storage order of the last call of each peer. They are not exposed to the C API.
+	std::list<CallHistorySummary> getCallHistorySummaries(const std::shared_ptr<CallLog> &after, int limit);
 	std::shared_ptr<CallLog> getLastOutgoingCall();
 	void deleteCallHistory();
 
@@ -39,6 +39,7 @@ LINPHONE_BEGIN_NAMESPACE
 IceService::IceService(StreamsGroup &sg) : mStreamsGroup(sg) {
 	LinphoneConfig *config = linphone_core_get_config(getCCore());
 	mAllowLateIce = !!linphone_config_get_int(config, "net", "allow_late_ice", 0);
+	mEarlyOffer = !!linphone_config_get_int(config, "net", "ice_early_offer", 0);
 	mEnableIntegrityCheck = !!linphone_config_get_int(config, "net", "ice_session_enable_message_integrity_check", 1);
 	mDontDefaultToStunCandidates = linphone_config_get_int(config, "net", "dont_default_to_stun_candidates", 0);
 }
@@ -230,6 +231,9 @@ bool IceService::prepare() {
 
 	if (!mIceSession) return false;
 
+	// An offer may have been sent before the end of the gathering, do not start it again
+	if (mGatheringInProgress) return true;
+
 	// Start ICE gathering if needed.
 	if (!ice_session_candidates_gathered(mIceSession)) {
 		int err = gatherIceCandidates();
@@ -240,6 +244,7 @@ bool IceService::prepare() {
 			deleteSession();
 			return false;
 		}
+		mGatheringInProgress = true;
 		return true;
 	}
 	return false;
@@ -711,6 +716,7 @@ void IceService::updateLocalMediaDescriptionFromIce(std::shared_ptr<SalMediaDesc
 }
 
 void IceService::gatheringFinished() {
+	mGatheringInProgress = false;
 	if (!mIceSession) return;
 
 	int pingTime = ice_session_average_gathering_round_trip_time(mIceSession);
@@ -764,6 +770,13 @@ const struct addrinfo *IceService::getIcePreferredStunServerAddrinfo(const struc
 	return preferredAi;
 }
 
+void IceService::useGatheredCandidates() {
+	if (!mIceSession) return;
+	lInfo() << "ICE: using the candidates gathered so far, the others will be advertised once gathering is finished";
+	// The flag is reset by the next fillLocalMediaDescription() and set again by gatheringFinished()
+	mGatheringFinished = true;
+}
+
 void IceService::finishPrepare() {
 	if (!mIceSession) return;
 	gatheringFinished();
@@ -804,6 +817,7 @@ void IceService::deleteSession() {
 	}
 	ice_session_destroy(mIceSession);
 	mIceSession = nullptr;
+	mGatheringInProgress = false;
 }
 
 void IceService::setListener(IceServiceListener *listener) {
@@ -58,6 +58,18 @@ public:
 	/* Called after a network connectivity change, to restart ICE from the beginning.*/
 	void resetSession();
 
+	/* Returns true if an offer may be sent before the end of the candidates gathering, see useGatheredCandidates(). */
+	bool isEarlyOfferEnabled() const {
+		return mEarlyOffer;
+	}
+
+	/*
+	 * Makes the next local media description advertise the candidates gathered so far (host and configured server
+	 * reflexive ones) without waiting for the STUN/TURN gathering, which keeps running. The candidates it finds are
+	 * advertised in the next local media description filled once the gathering is finished.
+	 */
+	void useGatheredCandidates();
+
 	/* Returns true if the incoming offer requires a defered response, due to check-list(s) not yet completed.*/
 	bool reinviteNeedsDeferedResponse(const std::shared_ptr<SalMediaDescription> &remoteMd);
 
@@ -154,7 +166,9 @@ private:
 	IceSession *mIceSession = nullptr;
 	IceServiceListener *mListener = nullptr;
 	bool mGatheringFinished = false;
+	bool mGatheringInProgress = false;
 	bool mAllowLateIce = false;
+	bool mEarlyOffer = false;
 	bool mDontDefaultToStunCandidates = false;
 	bool mEnableIntegrityCheck = true;
 	bool mIceWasDisabled = false; // Remember that at some point ICE was disabled by an incoming offer or answer.
@@ -91,7 +91,7 @@ int SalCallOp::setLocalBody(Content &&body) {
 		if (body.getSize() > 0) {
 			belle_sdp_session_description_t *sdp = belle_sdp_session_description_parse(body.getBodyAsString().c_str());
 			if (!sdp) return -1;
-			desc = std::make_shared<SalMediaDescription>(sdp);
+			desc = std::make_shared<SalMediaDescription>(sdp, mRoot->getMaxPotentialConfigurations());
 			if (!desc) {
 				return -1;
 			}
@@ -449,7 +449,7 @@ void SalCallOp::handleBodyFromResponse(belle_sip_response_t *response) {
 		if (parseSdpBody(sdpBody, &sdp, &reason) == 0) {
 			if (sdp) {
 
-				mRemoteMedia = std::make_shared<SalMediaDescription>(sdp);
+				mRemoteMedia = std::make_shared<SalMediaDescription>(sdp, mRoot->getMaxPotentialConfigurations());
 				mRemoteBody = std::move(sdpBody);
 				belle_sip_object_unref(sdp);
 			} // If no SDP in response, what can we do?
@@ -764,7 +764,7 @@ SalReason SalCallOp::processBodyForInvite(belle_sip_request_t *invite) {
 		if (parseSdpBody(sdpBody, &sdp, &reason) == 0) {
 			if (sdp) {
 				mSdpOffering = false;
-				mRemoteMedia = std::make_shared<SalMediaDescription>(sdp);
+				mRemoteMedia = std::make_shared<SalMediaDescription>(sdp, mRoot->getMaxPotentialConfigurations());
 				// Make some sanity check about the received SDP
 				if (!isMediaDescriptionAcceptable(mRemoteMedia)) reason = SalReasonNotAcceptable;
 				belle_sip_object_unref(sdp);
@@ -805,7 +805,7 @@ SalReason SalCallOp::processBodyForAck(belle_sip_request_t *ack) {
 		belle_sdp_session_description_t *sdp;
 		if (parseSdpBody(sdpBody, &sdp, &reason) == 0) {
 			if (sdp) {
-				mRemoteMedia = std::make_shared<SalMediaDescription>(sdp);
+				mRemoteMedia = std::make_shared<SalMediaDescription>(sdp, mRoot->getMaxPotentialConfigurations());
 				sdpProcess();
 				belle_sip_object_unref(sdp);
 			} else {
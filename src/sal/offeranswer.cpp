@@ -1019,6 +1019,7 @@ OfferAnswerEngine::initiateOutgoing(MSFactory *factory,
 	auto result = std::make_shared<SalMediaDescription>(local_offer->getParams());
 	const bool capabilityNegotiation = result->getParams().capabilityNegotiationSupported();
 
+	result->streams.reserve(local_offer->streams.size());
 	for (i = 0; i < local_offer->streams.size(); ++i) {
 		ms_message("Processing for stream %zu", i);
 		SalStreamDescription &ls = local_offer->streams[i];
@@ -1040,7 +1041,7 @@ OfferAnswerEngine::initiateOutgoing(MSFactory *factory,
 				                                  rs.getChosenConfiguration().rtcp_fb.tmmbr_enabled;
 				stream.addActualConfiguration(actualCfg);
 			}
-			result->streams.push_back(stream);
+			result->streams.push_back(std::move(stream));
 		} else {
 			ms_warning("No matching stream for %zu", i);
 		}
@@ -1106,6 +1107,7 @@ OfferAnswerEngine::initiateIncoming(MSFactory *factory,
 	}
 
 	const bool capabilityNegotiation = result->getParams().capabilityNegotiationSupported();
+	result->streams.reserve(remote_offer->streams.size());
 	for (auto &rs : remote_offer->streams) {
 		SalStreamDescription &ls = local_capabilities->streams[i];
 		SalStreamDescription stream;
@@ -1158,7 +1160,7 @@ OfferAnswerEngine::initiateIncoming(MSFactory *factory,
 			stream.custom_sdp_attributes = sal_custom_sdp_attribute_clone(ls.custom_sdp_attributes);
 		}
 		stream.addActualConfiguration(actualCfg);
-		result->streams.push_back(stream);
+		result->streams.push_back(std::move(stream));
 		i++;
 	}
 	result->username=local_capabilities->username;
@@ -40,7 +40,7 @@ LINPHONE_BEGIN_NAMESPACE
 
 class SalMediaDescription;
 
-class OfferAnswerEngine {
+class LINPHONE_INTERNAL_PUBLIC OfferAnswerEngine {
 
 public:
 	using optional_sal_stream_configuration = std::optional<SalStreamConfiguration>;
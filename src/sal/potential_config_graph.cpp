@@ -18,17 +18,41 @@
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include <regex>
+#include <cctype>
+#include <cstdlib>
 
 #include "linphone/utils/utils.h"
 #include "potential_config_graph.h"
 
 LINPHONE_BEGIN_NAMESPACE
 
-PotentialCfgGraph::PotentialCfgGraph() {
+unsigned int PotentialCfgGraph::getMaxConfigurationsPerStream() const {
+	return maxConfigurationsPerStream;
 }
 
-PotentialCfgGraph::PotentialCfgGraph(const belle_sdp_session_description_t *session_desc) : PotentialCfgGraph() {
+bool PotentialCfgGraph::canAddConfiguration(const media_description_config &config, const unsigned int &id) const {
+	// Configurations are tried in ascending index order, the lower the index the more preferred the configuration
+	return (config.size() < maxConfigurationsPerStream) || (id < std::prev(config.cend())->first);
+}
+
+void PotentialCfgGraph::addConfiguration(media_description_config &config,
+                                         const unsigned int &id,
+                                         const config_attribute &attr_configs) const {
+	config[id] = attr_configs;
+	// Make room by dropping the least preferred configuration
+	if (config.size() > maxConfigurationsPerStream) {
+		config.erase(std::prev(config.end()));
+	}
+}
+
+PotentialCfgGraph::PotentialCfgGraph(unsigned int maxConfigurations)
+    // At least one configuration must be kept otherwise capability negotiation can never succeed
+    : maxConfigurationsPerStream(std::max(maxConfigurations, 1u)) {
+}
+
+PotentialCfgGraph::PotentialCfgGraph(const belle_sdp_session_description_t *session_desc,
+                                     unsigned int maxConfigurations)
+    : PotentialCfgGraph(maxConfigurations) {
 	processSessionDescription(session_desc);
 }
 
@@ -38,6 +62,7 @@ PotentialCfgGraph &PotentialCfgGraph::operator=(const PotentialCfgGraph &other)
 	cfgs = other.cfgs;
 	acap = other.acap;
 	tcap = other.tcap;
+	maxConfigurationsPerStream = other.maxConfigurationsPerStream;
 
 	return *this;
 }
@@ -223,6 +248,11 @@ bool PotentialCfgGraph::processMediaAcfg(const unsigned int &idx, const belle_sd
 	for (belle_sip_list_t *attr = attrs; attr != NULL; attr = attr->next) {
 		belle_sdp_acfg_attribute_t *lAttribute = static_cast<belle_sdp_acfg_attribute_t *>(attr->data);
 		auto id = static_cast<unsigned int>(belle_sdp_acfg_attribute_get_id(lAttribute));
+		if (!canAddConfiguration(config, id)) {
+			lWarning() << "Ignoring acfg " << id << " of stream " << idx << " because only the "
+			           << maxConfigurationsPerStream << " most preferred configurations are kept";
+			continue;
+		}
 
 		auto attr_configs = createAConfigFromAttribute(lAttribute, mediaAcap, mediaTcap);
 		if (attr_configs.acap.empty() && attr_configs.tcap.empty()) {
@@ -233,7 +263,7 @@ bool PotentialCfgGraph::processMediaAcfg(const unsigned int &idx, const belle_sd
 			unparsed_config[id] = attrString;
 			belle_sip_free(attrString);
 		} else {
-			config[id] = attr_configs;
+			addConfiguration(config, id, attr_configs);
 		}
 	}
 
@@ -259,18 +289,23 @@ bool PotentialCfgGraph::processMediaPcfg(const unsigned int &idx, const belle_sd
 	belle_sip_list_t *attrs = belle_sdp_media_description_find_attributes_with_name(media_desc, "pcfg");
 	media_description_unparsed_config unparsed_config;
 	media_description_config config;
+	const auto mediaAcap = getAllAcapForStream(idx);
+	const auto mediaTcap = getAllTcapForStream(idx);
 	for (belle_sip_list_t *attr = attrs; attr != NULL; attr = attr->next) {
 		belle_sdp_pcfg_attribute_t *lAttribute = static_cast<belle_sdp_pcfg_attribute_t *>(attr->data);
 		auto id = static_cast<unsigned int>(belle_sdp_pcfg_attribute_get_id(lAttribute));
+		if (!canAddConfiguration(config, id)) {
+			lWarning() << "Ignoring pcfg " << id << " of stream " << idx << " because only the "
+			           << maxConfigurationsPerStream << " most preferred configurations are kept";
+			continue;
+		}
 
-		const auto mediaAcap = getAllAcapForStream(idx);
-		const auto mediaTcap = getAllTcapForStream(idx);
 		auto attr_configs = createPConfigFromAttribute(lAttribute, mediaAcap, mediaTcap);
 		if (attr_configs.acap.empty() && attr_configs.tcap.empty()) {
 			lInfo() << "Unable to build a potential config for id " << id;
 			unparsed_config[id] = belle_sip_object_to_string(lAttribute);
 		} else {
-			config[id] = attr_configs;
+			addConfiguration(config, id, attr_configs);
 		}
 	}
 
@@ -449,21 +484,22 @@ capability_type_t PotentialCfgGraph::capabilityTypeFromAttrParam(const std::stri
 }
 
 unsigned int PotentialCfgGraph::getElementIdx(const std::string &index) const {
-	std::regex indexRegex("(\\d+)");
-	auto indexBegin = std::sregex_iterator(index.begin(), index.end(), indexRegex);
-	auto indexEnd = std::sregex_iterator();
-
-	if (indexBegin == indexEnd) {
+	// Scan the string by hand rather than through a regular expression as this is called for every index of every
+	// configuration attribute
+	auto isDigit = [](const char &c) { return std::isdigit(static_cast<unsigned char>(c)) != 0; };
+	const auto indexBegin = std::find_if(index.cbegin(), index.cend(), isDigit);
+	if (indexBegin == index.cend()) {
 		lDebug() << "Unable to find index in string " << index;
+		return 0;
 	}
 
-	auto noMatches = std::distance(indexBegin, indexEnd);
-	if (noMatches > 1) {
-		lError() << "Expected one match but found " << noMatches << " instead - only first match will be honored";
+	const auto indexEnd = std::find_if_not(indexBegin, index.cend(), isDigit);
+	if (std::find_if(indexEnd, index.cend(), isDigit) != index.cend()) {
+		lError() << "Expected one match but found more in " << index << " - only first match will be honored";
 	}
 
-	std::smatch match = *indexBegin;
-	return static_cast<unsigned int>(std::stoi(match.str()));
+	// strtoul saturates instead of throwing on out of range values
+	return static_cast<unsigned int>(std::strtoul(std::string(indexBegin, indexEnd).c_str(), nullptr, 10));
 }
 
 const PotentialCfgGraph::session_description_config &PotentialCfgGraph::getAllCfg() const {
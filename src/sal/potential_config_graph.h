@@ -86,8 +86,15 @@ public:
 
 	static unsigned int getFreeIdx(const std::list<unsigned int> &l);
 
-	explicit PotentialCfgGraph();
-	explicit PotentialCfgGraph(const belle_sdp_session_description_t *session_desc);
+	static constexpr unsigned int defaultMaxConfigurationsPerStream = 32;
+
+	// maxConfigurations bounds the number of configurations kept per stream and the number of alternatives kept per
+	// capability list, so that an SDP carrying a large number of acap/tcap/pcfg attributes cannot make the
+	// enumeration of potential configurations explode. At least one configuration is always kept.
+	explicit PotentialCfgGraph(unsigned int maxConfigurations = defaultMaxConfigurationsPerStream);
+	explicit PotentialCfgGraph(const belle_sdp_session_description_t *session_desc,
+	                           unsigned int maxConfigurations = defaultMaxConfigurationsPerStream);
+	unsigned int getMaxConfigurationsPerStream() const;
 	PotentialCfgGraph &operator=(const PotentialCfgGraph &other);
 	const session_description_config &getAllCfg() const;
 	const session_description_unparsed_config &getUnparsedCfgs() const;
@@ -132,6 +139,8 @@ public:
 
 protected:
 private:
+	unsigned int maxConfigurationsPerStream = defaultMaxConfigurationsPerStream;
+
 	// configuration list
 	// Each element of the vector is a media session
 	media_description_acap globalAcap;
@@ -170,6 +179,10 @@ private:
 	                     const config_type_t cfgType);
 	bool processMediaAcfg(const unsigned int &idx, const belle_sdp_media_description_t *media_desc);
 	bool processMediaPcfg(const unsigned int &idx, const belle_sdp_media_description_t *media_desc);
+	bool canAddConfiguration(const media_description_config &config, const unsigned int &id) const;
+	void addConfiguration(media_description_config &config,
+	                      const unsigned int &id,
+	                      const config_attribute &attr_configs) const;
 	// TODO: should attribute have const? belle_sdp_pcfg_attribute_get_configs takes a non const
 	media_description_config::mapped_type createPConfigFromAttribute(belle_sdp_pcfg_attribute_t *attribute,
 	                                                                 const media_description_acap &mediaAcap,
@@ -228,6 +241,11 @@ PotentialCfgGraph::parseIdxList(const std::string &idxList,
 	std::list<std::list<config_capability<cap_type>>> capList;
 	bool success = true;
 	for (const auto &config : attrCapList) {
+		if (capList.size() >= maxConfigurationsPerStream) {
+			lWarning() << "Ignoring alternatives beyond the first " << maxConfigurationsPerStream
+			           << " in capability list " << idxList;
+			break;
+		}
 		const char capDelim = ',';
 		const auto capIdList = bctoolbox::Utils::split(config, capDelim);
 		std::list<config_capability<cap_type>> caps;
@@ -43,7 +43,8 @@ using namespace std;
 
 LINPHONE_BEGIN_NAMESPACE
 
-void Sal::processDialogTerminatedCb(BCTBX_UNUSED(void *sal), const belle_sip_dialog_terminated_event_t *event) {
+void Sal::processDialogTerminatedCb(void *sal, const belle_sip_dialog_terminated_event_t *event) {
+	static_cast<Sal *>(sal)->stopWaitingForEvents();
 	auto dialog = belle_sip_dialog_terminated_event_get_dialog(event);
 	auto op = static_cast<SalOp *>(belle_sip_dialog_get_application_data(dialog));
 	if (op && op->mCallbacks && op->mCallbacks->process_dialog_terminated)
@@ -51,7 +52,8 @@ void Sal::processDialogTerminatedCb(BCTBX_UNUSED(void *sal), const belle_sip_dia
 	else lError() << "Sal::processDialogTerminatedCb(): no op found for this dialog [" << dialog << "], ignoring";
 }
 
-void Sal::processIoErrorCb(BCTBX_UNUSED(void *userCtx), const belle_sip_io_error_event_t *event) {
+void Sal::processIoErrorCb(void *userCtx, const belle_sip_io_error_event_t *event) {
+	static_cast<Sal *>(userCtx)->stopWaitingForEvents();
 	if (BELLE_SIP_OBJECT_IS_INSTANCE_OF(belle_sip_io_error_event_get_source(event), belle_sip_client_transaction_t)) {
 		auto client_transaction = BELLE_SIP_CLIENT_TRANSACTION(belle_sip_io_error_event_get_source(event));
 		auto op =
@@ -66,6 +68,7 @@ void Sal::processIoErrorCb(BCTBX_UNUSED(void *userCtx), const belle_sip_io_error
 
 void Sal::processRequestEventCb(void *userCtx, const belle_sip_request_event_t *event) {
 	auto sal = static_cast<Sal *>(userCtx);
+	sal->stopWaitingForEvents();
 	SalOp *op = nullptr;
 	belle_sip_header_t *evh = nullptr;
 	auto request = belle_sip_request_event_get_request(event);
@@ -274,7 +277,8 @@ void Sal::processRequestEventCb(void *userCtx, const belle_sip_request_event_t *
 	else lError() << "Sal::processRequestEventCb(): not implemented yet";
 }
 
-void Sal::processResponseEventCb(BCTBX_UNUSED(void *userCtx), const belle_sip_response_event_t *event) {
+void Sal::processResponseEventCb(void *userCtx, const belle_sip_response_event_t *event) {
+	static_cast<Sal *>(userCtx)->stopWaitingForEvents();
 	auto response = belle_sip_response_event_get_response(event);
 	int responseCode = belle_sip_response_get_status_code(response);
 
@@ -362,7 +366,8 @@ void Sal::processResponseEventCb(BCTBX_UNUSED(void *userCtx), const belle_sip_re
 	}
 }
 
-void Sal::processTimeoutCb(BCTBX_UNUSED(void *userCtx), const belle_sip_timeout_event_t *event) {
+void Sal::processTimeoutCb(void *userCtx, const belle_sip_timeout_event_t *event) {
+	static_cast<Sal *>(userCtx)->stopWaitingForEvents();
 	auto clientTransaction = belle_sip_timeout_event_get_client_transaction(event);
 	auto op =
 	    static_cast<SalOp *>(belle_sip_transaction_get_application_data(BELLE_SIP_TRANSACTION(clientTransaction)));
@@ -392,6 +397,7 @@ void Sal::processTransactionTerminatedCb(BCTBX_UNUSED(void *userCtx),
 
 void Sal::processAuthRequestedCb(void *userCtx, belle_sip_auth_event_t *event) {
 	auto sal = static_cast<Sal *>(userCtx);
+	sal->stopWaitingForEvents();
 	SalAuthInfo *authInfo = sal_auth_info_create(event);
 	sal->mCallbacks.auth_requested(sal, authInfo);
 	belle_sip_auth_event_set_passwd(event, (const char *)authInfo->password);
@@ -402,9 +408,25 @@ void Sal::processAuthRequestedCb(void *userCtx, belle_sip_auth_event_t *event) {
 	sal_auth_info_delete(authInfo);
 }
 
-Sal::Sal(MSFactory *factory) : mFactory(factory) {
+mutex Sal::sGroupsMutex;
+unordered_map<string, Sal::Group> Sal::sGroups;
+
+Sal::Sal(MSFactory *factory, const string &group) : mFactory(factory), mGroup(group) {
 	// First create the stack, which initializes the belle-sip object's pool for this thread
-	mStack = belle_sip_stack_new(nullptr);
+	if (mGroup.empty()) {
+		mStack = belle_sip_stack_new(nullptr);
+	} else {
+		lock_guard<mutex> lock(sGroupsMutex);
+		Group &sharedGroup = sGroups[mGroup];
+		if (sharedGroup.stack) {
+			belle_sip_object_ref(sharedGroup.stack);
+		} else {
+			sharedGroup.stack = belle_sip_stack_new(nullptr);
+			lInfo() << "Created SIP stack shared by core group [" << mGroup << "]";
+		}
+		mStack = sharedGroup.stack;
+		sharedGroup.members.push_back(this);
+	}
 
 	mUserAgentHeader = belle_sip_header_user_agent_new();
 #if defined(PACKAGE_NAME) && defined(LIBLINPHONE_VERSION)
@@ -431,6 +453,12 @@ Sal::Sal(MSFactory *factory) : mFactory(factory) {
 }
 
 Sal::~Sal() {
+	if (!mGroup.empty()) {
+		lock_guard<mutex> lock(sGroupsMutex);
+		auto it = sGroups.find(mGroup);
+		it->second.members.remove(this);
+		if (it->second.members.empty()) sGroups.erase(it);
+	}
 	belle_sip_object_unref(mUserAgentHeader);
 	belle_sip_object_unref(mProvider);
 	belle_sip_object_unref(mStack);
@@ -438,6 +466,33 @@ Sal::~Sal() {
 	if (mSupportedHeader) belle_sip_object_unref(mSupportedHeader);
 }
 
+list<Sal *> Sal::getGroupMembers() {
+	if (mGroup.empty()) return {this};
+	lock_guard<mutex> lock(sGroupsMutex);
+	return sGroups[mGroup].members;
+}
+
+int Sal::iterate(unsigned int maxWaitMs) {
+	if (maxWaitMs == 0) {
+		belle_sip_stack_sleep(mStack, 0);
+		return 0;
+	}
+
+	// Any Sal of the group may receive the event that ends the wait, since they all share the stack's main loop.
+	const auto members = getGroupMembers();
+	for (auto member : members)
+		member->mWaitingForEvents = true;
+	belle_sip_stack_sleep(mStack, maxWaitMs);
+	for (auto member : members)
+		member->mWaitingForEvents = false;
+	return 0;
+}
+
+void Sal::stopWaitingForEvents() {
+	// The main loop stops once the sources that are ready have been dispatched, so no event is delayed.
+	if (mWaitingForEvents) belle_sip_main_loop_quit(belle_sip_stack_get_main_loop(mStack));
+}
+
 void Sal::setCallbacks(const Callbacks *cbs) {
 	memcpy(&mCallbacks, cbs, sizeof(*cbs));
 	if (!mCallbacks.call_received) mCallbacks.call_received = (OnCallReceivedCb)unimplementedStub;
@@ -22,10 +22,14 @@
 #define _L_SAL_H_
 
 #include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "linphone/types.h"
 #include "linphone/utils/general.h"
+#include "sal/potential_config_graph.h"
 #include "sal/sal_stream_configuration.h"
 
 #include "c-wrapper/internal/c-sal.h"
@@ -129,7 +133,8 @@ public:
 		OnRedirectCb process_redirect;
 	};
 
-	Sal(MSFactory *factory);
+	// Sal instances created with the same non-empty group share a single SIP stack, hence a single event loop.
+	Sal(MSFactory *factory, const std::string &group = "");
 	~Sal();
 
 	void setFactory(MSFactory *value) {
@@ -149,10 +154,15 @@ public:
 		return mStack;
 	}
 
-	int iterate() {
-		belle_sip_stack_sleep(mStack, 0);
-		return 0;
+	const std::string &getGroup() const {
+		return mGroup;
 	}
+	// Returns the Sal instances sharing the SIP stack of this one, itself included.
+	std::list<Sal *> getGroupMembers();
+
+	// Dispatches pending SIP events, blocking for at most maxWaitMs if none is ready. A blocking wait ends as soon as
+	// a SIP message, transaction timeout or transport error has been dispatched.
+	int iterate(unsigned int maxWaitMs = 0);
 
 	void setSendError(int value) {
 		belle_sip_stack_set_send_error(mStack, value);
@@ -235,6 +245,13 @@ public:
 	void useDates(bool value) {
 		mUseDates = value;
 	}
+	// Bounds the SDP potential configurations kept per stream of the received offers and answers.
+	void setMaxPotentialConfigurations(unsigned int value) {
+		mMaxPotentialConfigurations = value;
+	}
+	unsigned int getMaxPotentialConfigurations() const {
+		return mMaxPotentialConfigurations;
+	}
 	void useOneMatchingCodecPolicy(bool value) {
 		mOneMatchingCodec = value;
 	}
@@ -397,6 +414,7 @@ private:
 	void addPendingAuth(SalOp *op);
 	void removePendingAuth(SalOp *op);
 	belle_sip_response_t *createResponseFromRequest(belle_sip_request_t *req, int code);
+	void stopWaitingForEvents();
 
 	static void unimplementedStub() {
 		lWarning() << "Unimplemented SAL callback";
@@ -414,7 +432,16 @@ private:
 	static void processTransactionTerminatedCb(void *userCtx, const belle_sip_transaction_terminated_event_t *event);
 	static void processAuthRequestedCb(void *userCtx, belle_sip_auth_event_t *event);
 
+	struct Group {
+		belle_sip_stack_t *stack = nullptr; // Owned by the members.
+		std::list<Sal *> members;
+	};
+
+	static std::mutex sGroupsMutex;
+	static std::unordered_map<std::string, Group> sGroups;
+
 	MSFactory *mFactory = nullptr;
+	std::string mGroup;
 	Callbacks mCallbacks = {0};
 	std::list<SalOp *> mPendingAuths;
 	belle_sip_stack_t *mStack = nullptr;
@@ -445,10 +472,12 @@ private:
 	bool mTlsVerify = true;
 	bool mTlsVerifyCn = true;
 	bool mUseDates = false;
+	unsigned int mMaxPotentialConfigurations = PotentialCfgGraph::defaultMaxConfigurationsPerStream;
 	bool mAutoContacts = true;
 	bool mEnableTestFeatures = false;
 	bool mNoInitialRoute = false;
 	bool mEnableSipUpdate = true;
+	bool mWaitingForEvents = false; // Set while iterate() blocks, so that SIP events end the wait
 	SalOpSDPHandling mDefaultSdpHandling = SalOpSDPNormal;
 	bool mPendingTransactionChecking = true; // For testing purposes
 	void *mSslConfig = nullptr;
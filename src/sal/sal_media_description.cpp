@@ -105,7 +105,51 @@ SalMediaDescription &SalMediaDescription::operator=(const SalMediaDescription &o
 	return *this;
 }
 
-SalMediaDescription::SalMediaDescription(belle_sdp_session_description_t *sdp)
+SalMediaDescription::SalMediaDescription(SalMediaDescription &&other) noexcept {
+	*this = std::move(other);
+}
+
+SalMediaDescription &SalMediaDescription::operator=(SalMediaDescription &&other) noexcept {
+	if (this == &other) return *this;
+
+	name = std::move(other.name);
+	username = std::move(other.username);
+	addr = std::move(other.addr);
+
+	bandwidth = other.bandwidth;
+	session_ver = other.session_ver;
+	session_id = other.session_id;
+	origin_addr = std::move(other.origin_addr);
+
+	dir = other.dir;
+	streams = std::move(other.streams);
+	sal_custom_sdp_attribute_free(custom_sdp_attributes);
+	custom_sdp_attributes = other.custom_sdp_attributes;
+	other.custom_sdp_attributes = nullptr;
+	rtcp_xr = other.rtcp_xr;
+
+	ice_ufrag = std::move(other.ice_ufrag);
+	ice_pwd = std::move(other.ice_pwd);
+	ice_lite = other.ice_lite;
+
+	accept_bundles = other.accept_bundles;
+	bundles = std::move(other.bundles);
+
+	record = other.record;
+
+	set_nortpproxy = other.set_nortpproxy;
+
+	params = std::move(other.params);
+
+	haveLimeIk = other.haveLimeIk;
+
+	times = std::move(other.times);
+
+	return *this;
+}
+
+SalMediaDescription::SalMediaDescription(belle_sdp_session_description_t *sdp,
+                                         unsigned int maxPotentialConfigurations)
     : SalMediaDescription(SalMediaDescriptionParams()) {
 	belle_sdp_connection_t *cnx;
 	belle_sdp_session_name_t *sname;
@@ -114,7 +158,7 @@ SalMediaDescription::SalMediaDescription(belle_sdp_session_description_t *sdp)
 
 	dir = SalStreamSendRecv;
 
-	PotentialCfgGraph potentialCfgGraph(sdp);
+	PotentialCfgGraph potentialCfgGraph(sdp, maxPotentialConfigurations);
 
 	// if received SDP has no valid capability negotiation attributes, then assume that it doesn't support capability
 	// negotiation
@@ -235,7 +279,7 @@ SalMediaDescription::SalMediaDescription(belle_sdp_session_description_t *sdp)
 		} else {
 			stream.fillStreamDescriptionFromSdp(this, sdp, media_desc);
 		}
-		streams.push_back(stream);
+		streams.push_back(std::move(stream));
 		currentStreamIdx++;
 	}
 }
@@ -1058,13 +1102,9 @@ const SalStreamDescription::acap_map_t &SalMediaDescription::getAcaps() const {
 const SalStreamDescription::tcap_map_t &SalMediaDescription::getTcaps() const {
 	return tcaps;
 }
-const SalStreamDescription::cfg_map SalMediaDescription::getCfgsForStream(const unsigned int &idx) const {
-	SalStreamDescription::cfg_map cfgs;
-	const SalStreamDescription &stream = getStreamIdx(idx);
-	if (stream != Utils::getEmptyConstRefObject<SalStreamDescription>()) {
-		cfgs = stream.getAllCfgs();
-	}
-	return cfgs;
+const SalStreamDescription::cfg_map &SalMediaDescription::getCfgsForStream(const unsigned int &idx) const {
+	// An empty stream description is returned for out of range indexes, which has no configuration
+	return getStreamIdx(idx).getAllCfgs();
 }
 
 const SalStreamDescription::acap_map_t SalMediaDescription::getAllAcapForStream(const unsigned int &idx) const {
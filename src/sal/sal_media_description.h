@@ -48,8 +48,10 @@ public:
 	static constexpr long long ntpToUnix = 2208988800;
 
 	SalMediaDescription(const SalMediaDescriptionParams &descParams);
-	SalMediaDescription(belle_sdp_session_description_t *sdp);
+	SalMediaDescription(belle_sdp_session_description_t *sdp,
+	                    unsigned int maxPotentialConfigurations = PotentialCfgGraph::defaultMaxConfigurationsPerStream);
 	SalMediaDescription(const SalMediaDescription &other);
+	SalMediaDescription(SalMediaDescription &&other) noexcept;
 	virtual ~SalMediaDescription();
 
 	belle_sdp_session_description_t *toSdp() const;
@@ -108,6 +110,7 @@ public:
 	const SalMediaDescriptionParams &getParams() const;
 
 	SalMediaDescription &operator=(const SalMediaDescription &other);
+	SalMediaDescription &operator=(SalMediaDescription &&other) noexcept;
 	bool operator==(const SalMediaDescription &other) const;
 	bool operator!=(const SalMediaDescription &other) const;
 	int equal(const SalMediaDescription &otherMd) const;
@@ -139,7 +142,7 @@ public:
 	const SalStreamDescription::acap_map_t getAllAcapForStream(const unsigned int &idx) const;
 	unsigned int getFreeAcapIdx() const;
 
-	const SalStreamDescription::cfg_map getCfgsForStream(const unsigned int &idx) const;
+	const SalStreamDescription::cfg_map &getCfgsForStream(const unsigned int &idx) const;
 	// Creates potential configuration based on stored tcap and acaps
 	void createPotentialConfigurationsForStream(const unsigned int &streamIdx,
 	                                            const bool delete_session_attributes,
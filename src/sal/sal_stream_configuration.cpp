@@ -41,13 +41,40 @@ SalStreamConfiguration::~SalStreamConfiguration() {
 }
 
 SalStreamConfiguration::SalStreamConfiguration(const SalStreamConfiguration &other) {
+	copyAttributes(other);
+	for (const auto &pt : other.payloads) {
+		payloads.push_back(payload_type_clone(pt));
+	}
+}
+
+SalStreamConfiguration::SalStreamConfiguration(SalStreamConfiguration &&other) noexcept {
+	moveAttributes(other);
+	payloads.swap(other.payloads);
+}
+
+SalStreamConfiguration &SalStreamConfiguration::operator=(const SalStreamConfiguration &other) {
+	copyAttributes(other);
+	replacePayloads(other.payloads);
+
+	return *this;
+}
+
+SalStreamConfiguration &SalStreamConfiguration::operator=(SalStreamConfiguration &&other) noexcept {
+	if (this != &other) {
+		moveAttributes(other);
+		// The payload types are owned by the list, take them over instead of cloning them
+		PayloadTypeHandler::clearPayloadList(payloads);
+		payloads.swap(other.payloads);
+	}
+
+	return *this;
+}
+
+void SalStreamConfiguration::copyAttributes(const SalStreamConfiguration &other) {
 	proto = other.proto;
 	proto_other = other.proto_other;
 	rtp_ssrc = other.rtp_ssrc;
 	rtcp_cname = other.rtcp_cname;
-	for (const auto &pt : other.payloads) {
-		payloads.push_back(payload_type_clone(pt));
-	}
 	ptime = other.ptime;
 	maxptime = other.maxptime;
 	dir = other.dir;
@@ -81,16 +108,15 @@ SalStreamConfiguration::SalStreamConfiguration(const SalStreamConfiguration &oth
 	delete_session_attributes = other.delete_session_attributes;
 }
 
-SalStreamConfiguration &SalStreamConfiguration::operator=(const SalStreamConfiguration &other) {
+void SalStreamConfiguration::moveAttributes(SalStreamConfiguration &other) {
 	proto = other.proto;
-	proto_other = other.proto_other;
+	proto_other = std::move(other.proto_other);
 	rtp_ssrc = other.rtp_ssrc;
-	rtcp_cname = other.rtcp_cname;
-	replacePayloads(other.payloads);
+	rtcp_cname = std::move(other.rtcp_cname);
 	ptime = other.ptime;
 	maxptime = other.maxptime;
 	dir = other.dir;
-	crypto = other.crypto;
+	crypto = std::move(other.crypto);
 	crypto_local_tag = other.crypto_local_tag;
 	max_rate = other.max_rate;
 	bundle_only = other.bundle_only;
@@ -99,7 +125,7 @@ SalStreamConfiguration &SalStreamConfiguration::operator=(const SalStreamConfigu
 	pad[1] = other.pad[1];
 	rtcp_fb = other.rtcp_fb;
 	rtcp_xr = other.rtcp_xr;
-	mid = other.mid;
+	mid = std::move(other.mid);
 	mid_rtp_ext_header_id = other.mid_rtp_ext_header_id;
 	mixer_to_client_extension_id = other.mixer_to_client_extension_id;
 	client_to_mixer_extension_id = other.client_to_mixer_extension_id;
@@ -110,16 +136,14 @@ SalStreamConfiguration &SalStreamConfiguration::operator=(const SalStreamConfigu
 	haveZrtpHash = other.haveZrtpHash;
 	haveLimeIk = other.haveLimeIk;
 	memcpy(zrtphash, other.zrtphash, sizeof(zrtphash));
-	dtls_fingerprint = other.dtls_fingerprint;
+	dtls_fingerprint = std::move(other.dtls_fingerprint);
 	dtls_role = other.dtls_role;
 	ttl = other.ttl;
 	index = other.index;
 	tcapIndex = other.tcapIndex;
-	acapIndexes = other.acapIndexes;
+	acapIndexes = std::move(other.acapIndexes);
 	delete_media_attributes = other.delete_media_attributes;
 	delete_session_attributes = other.delete_session_attributes;
-
-	return *this;
 }
 
 bool SalStreamConfiguration::isRecvOnly(const PayloadType *p) {
@@ -82,8 +82,10 @@ class LINPHONE_PUBLIC SalStreamConfiguration {
 public:
 	SalStreamConfiguration();
 	SalStreamConfiguration(const SalStreamConfiguration &other);
+	SalStreamConfiguration(SalStreamConfiguration &&other) noexcept;
 	virtual ~SalStreamConfiguration();
 	SalStreamConfiguration &operator=(const SalStreamConfiguration &other);
+	SalStreamConfiguration &operator=(SalStreamConfiguration &&other) noexcept;
 	int equal(const SalStreamConfiguration &other) const;
 	bool operator==(const SalStreamConfiguration &other) const;
 	bool operator!=(const SalStreamConfiguration &other) const;
@@ -169,6 +171,10 @@ private:
 	unsigned int tcapIndex = 0;
 	std::list<std::list<unsigned int>> acapIndexes;
 
+	// Copy or move everything but the payload types, which are owned by this configuration
+	void copyAttributes(const SalStreamConfiguration &other);
+	void moveAttributes(SalStreamConfiguration &other);
+
 	static bool isRecvOnly(const PayloadType *p);
 	static bool isSamePayloadType(const PayloadType *p1, const PayloadType *p2);
 	static bool isSamePayloadList(const std::list<PayloadType *> &l1, const std::list<PayloadType *> &l2);
@@ -59,45 +59,11 @@ SalStreamDescription::~SalStreamDescription() {
 }
 
 SalStreamDescription::SalStreamDescription(const SalStreamDescription &other) {
-	name = other.name;
-	type = other.type;
-	typeother = other.typeother;
-	rtp_addr = other.rtp_addr;
-	rtcp_addr = other.rtcp_addr;
-	rtp_port = other.rtp_port;
-	rtcp_port = other.rtcp_port;
-	acaps = other.acaps;
-	tcaps = other.tcaps;
-	for (const auto &cfg : other.cfgs) {
-		const auto result = cfgs.insert(cfg);
-		if (!result.second) cfgs[cfg.first] = cfg.second;
-	}
-	for (const auto &cfg : other.unparsed_cfgs) {
-		const auto result = unparsed_cfgs.insert(cfg);
-		if (!result.second) unparsed_cfgs[cfg.first] = cfg.second;
-	}
-	PayloadTypeHandler::clearPayloadList(already_assigned_payloads);
-	for (const auto &pt : other.already_assigned_payloads) {
-		already_assigned_payloads.push_back(payload_type_clone(pt));
-	}
-	bandwidth = other.bandwidth;
-	multicast_role = other.multicast_role;
-
-	ice_candidates = other.ice_candidates;
-	ice_remote_candidates = other.ice_remote_candidates;
-	ice_ufrag = other.ice_ufrag;
-	ice_pwd = other.ice_pwd;
-	ice_mismatch = other.ice_mismatch;
-
-	label = other.label;
-	content = other.content;
-
-	supportedEncryption = other.supportedEncryption;
-
-	sal_custom_sdp_attribute_free(custom_sdp_attributes);
-	custom_sdp_attributes = sal_custom_sdp_attribute_clone(other.custom_sdp_attributes);
+	*this = other;
+}
 
-	cfgIndex = other.cfgIndex;
+SalStreamDescription::SalStreamDescription(SalStreamDescription &&other) noexcept {
+	*this = std::move(other);
 }
 
 SalStreamDescription::SalStreamDescription(const SalMediaDescription *salMediaDesc,
@@ -570,7 +536,7 @@ SalStreamDescription::addAcapsToConfiguration(const SalStreamConfiguration &base
 	return cfgList;
 }
 
-const SalStreamDescription::cfg_map SalStreamDescription::getAllCfgs() const {
+const SalStreamDescription::cfg_map &SalStreamDescription::getAllCfgs() const {
 	return cfgs;
 }
 
@@ -779,15 +745,7 @@ void SalStreamDescription::createActualCfg(const SalMediaDescription *salMediaDe
 }
 
 SalStreamDescription &SalStreamDescription::operator=(const SalStreamDescription &other) {
-	name = other.name;
-	type = other.type;
-	typeother = other.typeother;
-	rtp_addr = other.rtp_addr;
-	rtcp_addr = other.rtcp_addr;
-	rtp_port = other.rtp_port;
-	rtcp_port = other.rtcp_port;
-	acaps = other.acaps;
-	tcaps = other.tcaps;
+	copyAttributes(other);
 	for (const auto &cfg : other.cfgs) {
 		const auto result = cfgs.insert(cfg);
 		if (!result.second) cfgs[cfg.first] = cfg.second;
@@ -800,6 +758,53 @@ SalStreamDescription &SalStreamDescription::operator=(const SalStreamDescription
 	for (const auto &pt : other.already_assigned_payloads) {
 		already_assigned_payloads.push_back(payload_type_clone(pt));
 	}
+	sal_custom_sdp_attribute_free(custom_sdp_attributes);
+	custom_sdp_attributes = sal_custom_sdp_attribute_clone(other.custom_sdp_attributes);
+
+	return *this;
+}
+
+SalStreamDescription &SalStreamDescription::operator=(SalStreamDescription &&other) noexcept {
+	if (this == &other) return *this;
+
+	moveAttributes(other);
+	// Configurations, payload types and custom attributes are taken over rather than cloned. As for the copy, the
+	// configurations of the other stream are merged into the ones already stored.
+	if (cfgs.empty()) {
+		cfgs.swap(other.cfgs);
+	} else {
+		for (auto &cfg : other.cfgs) {
+			cfgs[cfg.first] = std::move(cfg.second);
+		}
+		other.cfgs.clear();
+	}
+	if (unparsed_cfgs.empty()) {
+		unparsed_cfgs.swap(other.unparsed_cfgs);
+	} else {
+		for (auto &cfg : other.unparsed_cfgs) {
+			unparsed_cfgs[cfg.first] = std::move(cfg.second);
+		}
+		other.unparsed_cfgs.clear();
+	}
+	PayloadTypeHandler::clearPayloadList(already_assigned_payloads);
+	already_assigned_payloads.swap(other.already_assigned_payloads);
+	sal_custom_sdp_attribute_free(custom_sdp_attributes);
+	custom_sdp_attributes = other.custom_sdp_attributes;
+	other.custom_sdp_attributes = nullptr;
+
+	return *this;
+}
+
+void SalStreamDescription::copyAttributes(const SalStreamDescription &other) {
+	name = other.name;
+	type = other.type;
+	typeother = other.typeother;
+	rtp_addr = other.rtp_addr;
+	rtcp_addr = other.rtcp_addr;
+	rtp_port = other.rtp_port;
+	rtcp_port = other.rtcp_port;
+	acaps = other.acaps;
+	tcaps = other.tcaps;
 	bandwidth = other.bandwidth;
 	multicast_role = other.multicast_role;
 
@@ -811,15 +816,37 @@ SalStreamDescription &SalStreamDescription::operator=(const SalStreamDescription
 
 	supportedEncryption = other.supportedEncryption;
 
-	sal_custom_sdp_attribute_free(custom_sdp_attributes);
-	custom_sdp_attributes = sal_custom_sdp_attribute_clone(other.custom_sdp_attributes);
-
 	cfgIndex = other.cfgIndex;
 
 	label = other.label;
 	content = other.content;
+}
 
-	return *this;
+void SalStreamDescription::moveAttributes(SalStreamDescription &other) {
+	name = std::move(other.name);
+	type = other.type;
+	typeother = std::move(other.typeother);
+	rtp_addr = std::move(other.rtp_addr);
+	rtcp_addr = std::move(other.rtcp_addr);
+	rtp_port = other.rtp_port;
+	rtcp_port = other.rtcp_port;
+	acaps = std::move(other.acaps);
+	tcaps = std::move(other.tcaps);
+	bandwidth = other.bandwidth;
+	multicast_role = other.multicast_role;
+
+	ice_candidates = std::move(other.ice_candidates);
+	ice_remote_candidates = std::move(other.ice_remote_candidates);
+	ice_ufrag = std::move(other.ice_ufrag);
+	ice_pwd = std::move(other.ice_pwd);
+	ice_mismatch = other.ice_mismatch;
+
+	supportedEncryption = std::move(other.supportedEncryption);
+
+	cfgIndex = other.cfgIndex;
+
+	label = std::move(other.label);
+	content = std::move(other.content);
 }
 
 bool SalStreamDescription::operator==(const SalStreamDescription &other) const {
@@ -84,8 +84,10 @@ public:
 	                     const belle_sdp_media_description_t *media_desc,
 	                     const SalStreamDescription::raw_capability_negotiation_attrs_t &attrs);
 	SalStreamDescription(const SalStreamDescription &other);
+	SalStreamDescription(SalStreamDescription &&other) noexcept;
 	virtual ~SalStreamDescription();
 	SalStreamDescription &operator=(const SalStreamDescription &other);
+	SalStreamDescription &operator=(SalStreamDescription &&other) noexcept;
 	int compareToChosenConfiguration(const SalStreamDescription &other) const;
 	int compareToActualConfiguration(const SalStreamDescription &other) const;
 	int equal(const SalStreamDescription &other) const;
@@ -167,7 +169,7 @@ public:
 	void setContent(const std::string newContent);
 	const std::string &getContent() const;
 
-	const cfg_map getAllCfgs() const;
+	const cfg_map &getAllCfgs() const;
 
 	void setZrtpHash(const uint8_t enable, uint8_t *zrtphash = NULL);
 
@@ -216,6 +218,10 @@ private:
 	std::map<unsigned int, std::string> unparsed_cfgs;
 	std::list<LinphoneMediaEncryption> supportedEncryption;
 
+	// Copy or move everything but the configurations, payload types and custom attributes
+	void copyAttributes(const SalStreamDescription &other);
+	void moveAttributes(SalStreamDescription &other);
+
 	void fillStreamDescriptionFromSdp(const SalMediaDescription *salMediaDesc,
 	                                  const belle_sdp_session_description_t *sdp,
 	                                  const belle_sdp_media_description_t *media_desc);
@@ -43,6 +43,38 @@ const VbrCodecBitrate PayloadTypeHandler::defaultVbrCodecBitrates[] = {
 
 // =============================================================================
 
+PayloadTypeHandler::~PayloadTypeHandler() {
+	for (auto &entry : mCodecsListCache) {
+		clearPayloadList(entry.previousList);
+		clearPayloadList(entry.codecs);
+	}
+}
+
+std::list<OrtpPayloadType *> PayloadTypeHandler::clonePayloadList(const std::list<OrtpPayloadType *> &payloads) {
+	std::list<OrtpPayloadType *> result;
+	for (const auto &pt : payloads) {
+		result.push_back(payload_type_clone(pt));
+	}
+	return result;
+}
+
+// Tells whether both lists lead findPayloadTypeNumber() to the same numbers.
+bool PayloadTypeHandler::haveSameAssignments(const std::list<OrtpPayloadType *> &payloads1,
+                                             const std::list<OrtpPayloadType *> &payloads2) {
+	if (payloads1.size() != payloads2.size()) return false;
+	for (auto it1 = payloads1.cbegin(), it2 = payloads2.cbegin(); it1 != payloads1.cend(); ++it1, ++it2) {
+		const OrtpPayloadType *pt1 = *it1;
+		const OrtpPayloadType *pt2 = *it2;
+		if ((payload_type_get_number(pt1) != payload_type_get_number(pt2)) || (pt1->clock_rate != pt2->clock_rate) ||
+		    (pt1->channels != pt2->channels) || (strcasecmp(pt1->mime_type, pt2->mime_type) != 0))
+			return false;
+		if ((!pt1->recv_fmtp != !pt2->recv_fmtp) ||
+		    (pt1->recv_fmtp && (strcasecmp(pt1->recv_fmtp, pt2->recv_fmtp) != 0)))
+			return false;
+	}
+	return true;
+}
+
 int PayloadTypeHandler::findPayloadTypeNumber(const std::list<OrtpPayloadType *> &assigned, const OrtpPayloadType *pt) {
 	const OrtpPayloadType *candidate = nullptr;
 	for (const auto &it : assigned) {
@@ -280,6 +312,12 @@ std::list<OrtpPayloadType *> PayloadTypeHandler::makeCodecsList(SalStreamType ty
                                                                 int maxCodecs,
                                                                 const std::list<OrtpPayloadType *> &previousList,
                                                                 bool bundle_enabled) {
+	for (const auto &entry : mCodecsListCache) {
+		if ((entry.type == type) && (entry.bandwidthLimit == bandwidthLimit) && (entry.maxCodecs == maxCodecs) &&
+		    (entry.bundleEnabled == bundle_enabled) && haveSameAssignments(entry.previousList, previousList))
+			return clonePayloadList(entry.codecs);
+	}
+
 	const bctbx_list_t *allCodecs = nullptr;
 	switch (type) {
 		default:
@@ -334,6 +372,8 @@ std::list<OrtpPayloadType *> PayloadTypeHandler::makeCodecsList(SalStreamType ty
 		result.push_back(fec_pt);
 	}
 	assignPayloadTypeNumbers(result);
+	mCodecsListCache.push_back(
+	    {type, bandwidthLimit, maxCodecs, bundle_enabled, clonePayloadList(previousList), clonePayloadList(result)});
 	return result;
 }
 
@@ -45,10 +45,16 @@ struct VbrCodecBitrate {
 
 class Core;
 
-class PayloadTypeHandler : public CoreAccessor {
+class LINPHONE_INTERNAL_PUBLIC PayloadTypeHandler : public CoreAccessor {
 public:
 	explicit PayloadTypeHandler(const std::shared_ptr<Core> &core) : CoreAccessor(core) {
 	}
+	~PayloadTypeHandler();
+
+	// Results are memoized for the lifetime of the handler, which is expected to cover a single local media
+	// description build: streams sharing the same constraints (e.g. conference thumbnails) reuse the same codec list.
+	// Nothing is kept from one build to the next, nor from one offer/answer to the next: telling whether the codec
+	// settings are unchanged would require walking the same lists the memoized call walks.
 
 	std::list<OrtpPayloadType *> makeCodecsList(SalStreamType type,
 	                                            int bandwidthLimit,
@@ -68,6 +74,18 @@ public:
 	static void clearPayloadList(std::list<OrtpPayloadType *> &payloads);
 
 private:
+	struct CodecsListCacheEntry {
+		SalStreamType type;
+		int bandwidthLimit;
+		int maxCodecs;
+		bool bundleEnabled;
+		std::list<OrtpPayloadType *> previousList;
+		std::list<OrtpPayloadType *> codecs;
+	};
+
+	static std::list<OrtpPayloadType *> clonePayloadList(const std::list<OrtpPayloadType *> &payloads);
+	static bool haveSameAssignments(const std::list<OrtpPayloadType *> &payloads1,
+	                                const std::list<OrtpPayloadType *> &payloads2);
 	static int findPayloadTypeNumber(const std::list<OrtpPayloadType *> &assigned, const OrtpPayloadType *pt);
 	static bool hasTelephoneEventPayloadType(const std::list<OrtpPayloadType *> &tev, int rate);
 	static bool isPayloadTypeUsableForBandwidth(const OrtpPayloadType *pt, int bandwidthLimit);
@@ -79,6 +97,8 @@ private:
 	OrtpPayloadType *createFecPayloadType();
 	bool isPayloadTypeUsable(const OrtpPayloadType *pt);
 
+	std::list<CodecsListCacheEntry> mCodecsListCache;
+
 	static const int udpHeaderSize;
 	static const int rtpHeaderSize;
 	static const int ipv4HeaderSize;
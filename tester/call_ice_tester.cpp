@@ -858,6 +858,98 @@ static void call_with_ice_and_dual_stack_stun_server(void) {
 	linphone_core_manager_destroy(pauline);
 }
 
+/* A STUN server stand-in that never answers, so that the STUN gathering only ends on timeout. */
+static bctbx_socket_t create_silent_stun_server(int *port) {
+	struct sockaddr_in addr;
+	socklen_t addrlen = sizeof(addr);
+	bctbx_socket_t sock = socket(AF_INET, SOCK_DGRAM, 0);
+	if (sock == (bctbx_socket_t)-1) return sock;
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	if ((bind(sock, (struct sockaddr *)&addr, addrlen) != 0) ||
+	    (getsockname(sock, (struct sockaddr *)&addr, &addrlen) != 0)) {
+		bctbx_socket_close(sock);
+		return (bctbx_socket_t)-1;
+	}
+	*port = ntohs(addr.sin_port);
+	return sock;
+}
+
+static uint64_t call_with_silent_stun_server(LinphoneCoreManager *marie, LinphoneCoreManager *pauline) {
+	int incomingCount = pauline->stat.number_of_LinphoneCallIncomingReceived;
+	int marieStreamsRunningCount = marie->stat.number_of_LinphoneCallStreamsRunning;
+	int paulineStreamsRunningCount = pauline->stat.number_of_LinphoneCallStreamsRunning;
+	int paulineUpdatedCount = pauline->stat.number_of_LinphoneCallUpdatedByRemote;
+	uint64_t start = bctbx_get_cur_time_ms();
+	uint64_t timeToInvite = 0;
+
+	linphone_core_invite_address(marie->lc, pauline->identity);
+	BC_ASSERT_TRUE(
+	    wait_for(marie->lc, pauline->lc, &pauline->stat.number_of_LinphoneCallIncomingReceived, incomingCount + 1));
+	timeToInvite = bctbx_get_cur_time_ms() - start;
+
+	LinphoneCall *paulineCall = linphone_core_get_current_call(pauline->lc);
+	BC_ASSERT_PTR_NOT_NULL(paulineCall);
+	if (paulineCall) {
+		linphone_call_accept(paulineCall);
+		BC_ASSERT_TRUE(wait_for(marie->lc, pauline->lc, &marie->stat.number_of_LinphoneCallStreamsRunning,
+		                        marieStreamsRunningCount + 1));
+		BC_ASSERT_TRUE(wait_for(marie->lc, pauline->lc, &pauline->stat.number_of_LinphoneCallStreamsRunning,
+		                        paulineStreamsRunningCount + 1));
+
+		/* Wait for the ICE reINVITE, then for the end of the gathering */
+		BC_ASSERT_TRUE(wait_for(marie->lc, pauline->lc, &pauline->stat.number_of_LinphoneCallStreamsRunning,
+		                        paulineStreamsRunningCount + 2));
+		BC_ASSERT_TRUE(wait_for(marie->lc, pauline->lc, &marie->stat.number_of_LinphoneCallStreamsRunning,
+		                        marieStreamsRunningCount + 2));
+		LinphoneCall *marieCall = linphone_core_get_current_call(marie->lc);
+		IceSession *iceSession = marieCall ? linphone_call_get_ice_session(marieCall) : NULL;
+		BC_ASSERT_PTR_NOT_NULL(iceSession);
+		for (int attempts = 0; iceSession && !ice_session_candidates_gathered(iceSession) && attempts < 100; attempts++)
+			wait_for_until(marie->lc, pauline->lc, NULL, 0, 100);
+		wait_for_until(marie->lc, pauline->lc, NULL, 0, 1000);
+
+		/* The check lists completed before the gathering timed out, so no candidates are sent afterwards */
+		BC_ASSERT_EQUAL(pauline->stat.number_of_LinphoneCallUpdatedByRemote, paulineUpdatedCount + 1, int, "%d");
+		BC_ASSERT_TRUE(check_ice(marie, pauline, LinphoneIceStateHostConnection));
+		end_call(marie, pauline);
+	}
+	return timeToInvite;
+}
+
+static void call_with_ice_early_offer(void) {
+	LinphoneCoreManager *marie = linphone_core_manager_new("marie_rc");
+	LinphoneCoreManager *pauline =
+	    linphone_core_manager_new(transport_supported(LinphoneTransportTls) ? "pauline_rc" : "pauline_tcp_rc");
+	int stunPort = 0;
+	bctbx_socket_t stunSocket = create_silent_stun_server(&stunPort);
+	BC_ASSERT_TRUE(stunSocket != (bctbx_socket_t)-1);
+	if (stunSocket == (bctbx_socket_t)-1) goto end;
+	{
+		const std::string stunServer = "127.0.0.1:" + std::to_string(stunPort);
+		enable_stun_in_core(marie, TRUE, TRUE);
+		linphone_nat_policy_set_stun_server(linphone_core_get_nat_policy(marie->lc), stunServer.c_str());
+		linphone_core_manager_wait_for_stun_resolution(marie);
+		enable_stun_in_core(pauline, FALSE, TRUE);
+
+		/* Without early offer, the INVITE leaves once the STUN gathering has timed out */
+		uint64_t timeToInvite = call_with_silent_stun_server(marie, pauline);
+		ms_message("Time to first INVITE with ICE gathering: %llu ms", (unsigned long long)timeToInvite);
+
+		/* With early offer, the INVITE leaves with the host candidates while the gathering goes on */
+		linphone_config_set_int(linphone_core_get_config(marie->lc), "net", "ice_early_offer", 1);
+		uint64_t timeToEarlyInvite = call_with_silent_stun_server(marie, pauline);
+		ms_message("Time to first INVITE with ICE early offer: %llu ms", (unsigned long long)timeToEarlyInvite);
+		BC_ASSERT_LOWER((unsigned long long)timeToEarlyInvite, (unsigned long long)timeToInvite, unsigned long long,
+		                "%llu");
+	}
+	bctbx_socket_close(stunSocket);
+end:
+	linphone_core_manager_destroy(marie);
+	linphone_core_manager_destroy(pauline);
+}
+
 static void srtp_ice_call_to_no_encryption(void) {
 	LinphoneCoreManager *marie = linphone_core_manager_new("marie_rc");
 	LinphoneCoreManager *pauline =
@@ -993,7 +1085,8 @@ static test_t call_with_ice_tests[] = {
                   "DTLS"),
     TEST_ONE_TAG("Call terminated during ICE re-INVITE", call_terminated_during_ice_reinvite, "ICE"),
     TEST_ONE_TAG("Call with ICE using dual-stack stun server", call_with_ice_and_dual_stack_stun_server, "ICE"),
-    TEST_ONE_TAG("SRTP ice call to no encryption", srtp_ice_call_to_no_encryption, "ICE")};
+    TEST_ONE_TAG("SRTP ice call to no encryption", srtp_ice_call_to_no_encryption, "ICE"),
+    TEST_ONE_TAG("Call with ICE early offer", call_with_ice_early_offer, "ICE")};
 
 test_suite_t call_with_ice_test_suite = {"Call with ICE",
                                          NULL,
@@ -244,6 +244,114 @@ end:
 	linphone_core_manager_destroy(marie);
 }
 
+static void push_incoming_call_timeout(void) {
+	LinphoneCoreManager *marie = linphone_core_manager_new_with_proxies_check("empty_rc", FALSE);
+	linphone_core_set_push_incoming_call_timeout(marie->lc, 1);
+
+	LinphoneCall *call = linphone_call_new_incoming_with_callid(marie->lc, "push-incoming-timeout");
+	linphone_call_start_basic_incoming_notification(call);
+	linphone_call_start_push_incoming_notification(call);
+	BC_ASSERT_EQUAL(marie->stat.number_of_LinphoneCallPushIncomingReceived, 1, int, "%d");
+
+	// The timeout is only reached once more than one second has elapsed.
+	BC_ASSERT_FALSE(wait_for_until(marie->lc, NULL, &marie->stat.number_of_LinphoneCallReleased, 1, 500));
+	BC_ASSERT_TRUE(wait_for_until(marie->lc, NULL, &marie->stat.number_of_LinphoneCallReleased, 1, 5000));
+	BC_ASSERT_EQUAL(linphone_core_get_calls_nb(marie->lc), 0, int, "%d");
+	linphone_core_manager_destroy(marie);
+}
+
+/*
+ * A core started in background with push_wake_fast_start defers its non essential startup tasks until the call that
+ * woke it up is handled. The delays from the push to the REGISTER and to the answer are logged by the core.
+ * Meanwhile, the friend lists do not subscribe to presence.
+ */
+static void push_wake_fast_start(void) {
+	LinphoneCoreManager *marie = linphone_core_manager_new("marie_rc");
+	LinphoneCoreManager *pauline = linphone_core_manager_create("pauline_rc");
+	linphone_config_set_bool(linphone_core_get_config(pauline->lc), "misc", "push_wake_fast_start", TRUE);
+	linphone_core_enter_background(pauline->lc);
+
+	uint64_t start = bctbx_get_cur_time_ms();
+	linphone_core_manager_start(pauline, TRUE);
+	ms_message("Core started and registered in %llu ms", (unsigned long long)(bctbx_get_cur_time_ms() - start));
+
+	// Pauline watches Marie's presence, which she would subscribe to once registered.
+	LinphoneFriend *marie_friend = linphone_core_create_friend(pauline->lc);
+	linphone_friend_set_address(marie_friend, marie->identity);
+	linphone_friend_enable_subscribes(marie_friend, TRUE);
+	linphone_core_add_friend(pauline->lc, marie_friend);
+	linphone_friend_unref(marie_friend);
+	wait_for_until(pauline->lc, marie->lc, NULL, 0, 3000);
+	BC_ASSERT_TRUE(linphone_core_startup_tasks_deferred(pauline->lc));
+	BC_ASSERT_EQUAL(marie->stat.number_of_NewSubscriptionRequest, 0, int, "%d");
+
+	LinphoneCall *marie_call = linphone_core_invite_address(marie->lc, pauline->identity);
+	if (!BC_ASSERT_PTR_NOT_NULL(marie_call)) goto end;
+	linphone_core_push_notification_received(
+	    pauline->lc, "", linphone_call_log_get_call_id(linphone_call_get_call_log(marie_call)));
+
+	if (!BC_ASSERT_TRUE(wait_for(pauline->lc, marie->lc, &pauline->stat.number_of_LinphoneCallIncomingReceived, 1)))
+		goto end;
+	BC_ASSERT_TRUE(linphone_core_startup_tasks_deferred(pauline->lc));
+	BC_ASSERT_EQUAL(marie->stat.number_of_NewSubscriptionRequest, 0, int, "%d");
+	linphone_call_accept(linphone_core_get_current_call(pauline->lc));
+	BC_ASSERT_TRUE(wait_for(pauline->lc, marie->lc, &pauline->stat.number_of_LinphoneCallConnected, 1));
+	BC_ASSERT_TRUE(wait_for(pauline->lc, marie->lc, &marie->stat.number_of_LinphoneCallConnected, 1));
+
+	// The call that woke up the core is handled, the deferred tasks run.
+	BC_ASSERT_TRUE(wait_for(pauline->lc, marie->lc, &marie->stat.number_of_NewSubscriptionRequest, 1));
+	BC_ASSERT_FALSE(linphone_core_startup_tasks_deferred(pauline->lc));
+	end_call(marie, pauline);
+
+end:
+	linphone_core_manager_destroy(pauline);
+	linphone_core_manager_destroy(marie);
+}
+
+/*
+ * Measures the cost of linphone_core_iterate() and of Call-ID lookups as the number of pending calls grows.
+ * Calls are created from simulated push notifications, so that no SIP traffic is involved.
+ */
+static void iterate_with_many_push_incoming_calls(void) {
+	LinphoneCoreManager *marie = linphone_core_manager_new_with_proxies_check("empty_rc", FALSE);
+	const int counts[] = {10, 100, 500};
+	char callid[64];
+	int created = 0;
+
+	linphone_core_set_max_calls(marie->lc, counts[sizeof(counts) / sizeof(counts[0]) - 1]);
+	for (size_t i = 0; i < sizeof(counts) / sizeof(counts[0]); i++) {
+		for (; created < counts[i]; created++) {
+			snprintf(callid, sizeof(callid), "push-incoming-bench-%d", created);
+			LinphoneCall *call = linphone_call_new_incoming_with_callid(marie->lc, callid);
+			linphone_call_start_basic_incoming_notification(call);
+			linphone_call_start_push_incoming_notification(call);
+		}
+		BC_ASSERT_EQUAL(linphone_core_get_calls_nb(marie->lc), counts[i], int, "%d");
+
+		uint64_t start = bctbx_get_cur_time_ms();
+		for (int j = 0; j < 100; j++)
+			linphone_core_iterate(marie->lc);
+		uint64_t iterateDuration = bctbx_get_cur_time_ms() - start;
+
+		int found = 0;
+		start = bctbx_get_cur_time_ms();
+		for (int j = 0; j < 1000; j++) {
+			snprintf(callid, sizeof(callid), "push-incoming-bench-%d", j % created);
+			if (linphone_core_get_call_by_callid(marie->lc, callid)) found++;
+		}
+		uint64_t lookupDuration = bctbx_get_cur_time_ms() - start;
+		BC_ASSERT_EQUAL(found, 1000, int, "%d");
+
+		ms_message("%d calls: 100 core iterations took %llu ms, 1000 Call-ID lookups took %llu ms", counts[i],
+		           (unsigned long long)iterateDuration, (unsigned long long)lookupDuration);
+	}
+
+	linphone_core_terminate_all_calls(marie->lc);
+	BC_ASSERT_TRUE(wait_for_until(marie->lc, NULL, &marie->stat.number_of_LinphoneCallReleased, created, 10000));
+	BC_ASSERT_EQUAL(linphone_core_get_calls_nb(marie->lc), 0, int, "%d");
+	linphone_core_manager_destroy(marie);
+}
+
 test_t push_incoming_call_tests[] = {
     TEST_NO_TAG("Simple accept call", simple_accept_call),
     TEST_NO_TAG("Push accept call", push_accept_call),
@@ -256,6 +364,9 @@ test_t push_incoming_call_tests[] = {
     TEST_NO_TAG("Push decline call", push_decline_call),
     TEST_NO_TAG("Push early decline call", push_early_decline_call),
     TEST_NO_TAG("Shared core accept call", shared_core_accpet_call),
+    TEST_NO_TAG("Push incoming call timeout", push_incoming_call_timeout),
+    TEST_NO_TAG("Push wake fast start", push_wake_fast_start),
+    TEST_NO_TAG("Iterate with many push incoming calls", iterate_with_many_push_incoming_calls),
 };
 
 test_suite_t push_incoming_call_test_suite = {"Push Incoming Call",
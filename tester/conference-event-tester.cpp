@@ -34,6 +34,7 @@
 #include "conference/participant.h"
 #include "conference/remote-conference.h"
 #include "conference_private.h"
+#include "content/content-manager.h"
 #include "liblinphone_tester.h"
 #include "linphone/core.h"
 #include "private.h"
@@ -2383,6 +2384,59 @@ void one_to_one_keyword() {
 	linphone_core_manager_destroy(pauline);
 }
 
+void full_state_notify_for_many_conferences() {
+	LinphoneCoreManager *pauline =
+	    linphone_core_manager_new(transport_supported(LinphoneTransportTls) ? "pauline_rc" : "pauline_tcp_rc");
+	LinphoneAddress *cBobAddr = linphone_core_interpret_url(pauline->lc, bobUri);
+	std::shared_ptr<Address> bobAddr = Address::toCpp(cBobAddr)->getSharedFromThis();
+	linphone_address_unref(cBobAddr);
+	LinphoneAddress *cAliceAddr = linphone_core_interpret_url(pauline->lc, aliceUri);
+	std::shared_ptr<Address> aliceAddr = Address::toCpp(cAliceAddr)->getSharedFromThis();
+	linphone_address_unref(cAliceAddr);
+
+	const int nbConferences = 1000;
+	list<shared_ptr<LocalConference>> conferences;
+	for (int i = 0; i < nbConferences; i++) {
+		std::shared_ptr<Address> addr = Address::create(Address::toCpp(pauline->identity)->getUri());
+		addr->setUriParam("conf-id", std::to_string(i));
+		shared_ptr<LocalConference> localConf =
+		    make_shared<LocalConference>(pauline->lc->cppPtr, addr, nullptr, ConferenceParams::create(pauline->lc));
+		localConf->addParticipant(bobAddr);
+		localConf->addParticipant(aliceAddr);
+		localConf->setSubject("Room " + std::to_string(i));
+		localConf->setConferenceAddress(addr);
+		conferences.push_back(localConf);
+	}
+
+	// First pass builds the full state of every conference, the second one is served from the cache.
+	uint64_t elapsed[2];
+	for (int pass = 0; pass < 2; pass++) {
+		uint64_t start = bctbx_get_cur_time_ms();
+		for (const auto &localConf : conferences) {
+			LocalConferenceEventHandler *localHandler = (L_ATTR_GET(localConf.get(), eventHandler)).get();
+			Content content = localHandler->getNotifyForId(0, nullptr);
+			BC_ASSERT_FALSE(content.isEmpty());
+		}
+		elapsed[pass] = bctbx_get_cur_time_ms() - start;
+	}
+	ms_message("Full state NOTIFY bodies for %d conferences built in %llu ms, served from cache in %llu ms",
+	           nbConferences, (unsigned long long)elapsed[0], (unsigned long long)elapsed[1]);
+
+	// A change in a conference must not let a stale full state be sent.
+	shared_ptr<LocalConference> firstConf = conferences.front();
+	firstConf->setSubject("Another subject");
+	LocalConferenceEventHandler *firstHandler = (L_ATTR_GET(firstConf.get(), eventHandler)).get();
+	Content content = firstHandler->getNotifyForId(0, nullptr);
+	list<Content> parts = ContentManager::multipartToContentList(content);
+	BC_ASSERT_EQUAL((int)parts.size(), 1, int, "%d");
+	if (!parts.empty()) {
+		BC_ASSERT_TRUE(parts.front().getBodyAsUtf8String().find("Another subject") != string::npos);
+	}
+
+	conferences.clear();
+	linphone_core_manager_destroy(pauline);
+}
+
 test_t conference_event_tests[] = {
     TEST_NO_TAG("First notify parsing", first_notify_parsing),
     TEST_NO_TAG("First notify with extensions parsing", first_notify_with_extensions_parsing),
@@ -2402,7 +2456,8 @@ test_t conference_event_tests[] = {
     TEST_NO_TAG("Send subject changed notify", send_subject_changed_notify),
     TEST_NO_TAG("Send device added notify", send_device_added_notify),
     TEST_NO_TAG("Send device removed notify", send_device_removed_notify),
-    TEST_NO_TAG("one-to-one keyword", one_to_one_keyword)};
+    TEST_NO_TAG("one-to-one keyword", one_to_one_keyword),
+    TEST_NO_TAG("Full state notify for many conferences", full_state_notify_for_many_conferences)};
 
 test_suite_t conference_event_test_suite = {"Conference event",
                                             nullptr,
@@ -246,6 +246,82 @@ static void build_ics() {
 	BC_ASSERT_STRING_EQUAL(confStr.c_str(), expectedIcs.c_str());
 }
 
+static void build_ics_memoized() {
+	auto confInfo = ConferenceInfo::create();
+	confInfo->setOrganizer(Address::create("sip:marie@sip.linphone.org"));
+	confInfo->addParticipant(Address::create("sip:pauline@sip.linphone.org"));
+	confInfo->setUri(Address::create("sip:videoconf1@sip.linphone.org"));
+	confInfo->setSubject("Memoized invitation");
+	confInfo->setDateTime(ms_time(NULL));
+	confInfo->setDuration(30);
+	confInfo->setCreationTime(0);
+
+	const string firstIcs = confInfo->toIcsString();
+	BC_ASSERT_FALSE(firstIcs.empty());
+	BC_ASSERT_STRING_EQUAL(confInfo->toIcsString().c_str(), firstIcs.c_str());
+	BC_ASSERT_TRUE(confInfo->toIcsString(true) != firstIcs);
+
+	// Any change to the conference information must be reflected in the next generated ICS.
+	confInfo->setSubject("Updated invitation");
+	const string updatedIcs = confInfo->toIcsString();
+	BC_ASSERT_TRUE(updatedIcs != firstIcs);
+	BC_ASSERT_PTR_NOT_NULL(strstr(updatedIcs.c_str(), "SUMMARY:Updated invitation"));
+
+	confInfo->addParticipant(Address::create("sip:laure@sip.linphone.org"));
+	BC_ASSERT_PTR_NOT_NULL(strstr(confInfo->toIcsString().c_str(), "sip:laure@sip.linphone.org"));
+}
+
+static void parse_ics_benchmark() {
+	const int iterations = 200;
+	const string str = "BEGIN:VCALENDAR\r\n"
+	                   "METHOD:REQUEST\r\n"
+	                   "PRODID:-//Linphone//Conference calendar//EN\r\n"
+	                   "VERSION:2.0\r\n"
+	                   "BEGIN:VEVENT\r\n"
+	                   "DTSTART:20210822T103000Z\r\n"
+	                   "DURATION:PT2H45M\r\n"
+	                   "ORGANIZER:sip:marie@sip.linphone.org\r\n"
+	                   "ATTENDEE;X-TEST=99:sip:laure@sip.linphone.org\r\n"
+	                   "ATTENDEE;X-TEST=99:sip:pauline@sip.linphone.org\r\n"
+	                   "X-CONFURI:sip:videoconf-benchmark@sip.linphone.org\r\n"
+	                   "SUMMARY:Parser benchmark\r\n"
+	                   "DESCRIPTION:Parsing the same invitation again and again\r\n"
+	                   "SEQUENCE:3\r\n"
+	                   "DTSTAMP:19700101T000000Z\r\n"
+	                   "UID:benchmark\r\n"
+	                   "END:VEVENT\r\n"
+	                   "END:VCALENDAR\r\n";
+
+	uint64_t start = bctbx_get_cur_time_ms();
+	for (int i = 0; i < iterations; i++) {
+		BC_ASSERT_PTR_NOT_NULL(Ics::Parser::getInstance()->parseIcs(str));
+	}
+	uint64_t uncachedTime = bctbx_get_cur_time_ms() - start;
+
+	shared_ptr<const Ics::Icalendar> ics = Ics::Icalendar::createFromString(str);
+	BC_ASSERT_PTR_NOT_NULL(ics);
+	if (!ics) return;
+
+	start = bctbx_get_cur_time_ms();
+	for (int i = 0; i < iterations; i++) {
+		BC_ASSERT_PTR_EQUAL(Ics::Icalendar::createFromString(str).get(), ics.get());
+	}
+	uint64_t cachedTime = bctbx_get_cur_time_ms() - start;
+
+	ms_message("Parsing the same ICS %d times took %llu ms without cache and %llu ms with cache", iterations,
+	           (unsigned long long)uncachedTime, (unsigned long long)cachedTime);
+	BC_ASSERT_LOWER((unsigned long long)cachedTime, (unsigned long long)uncachedTime, unsigned long long, "%llu");
+
+	// Each caller still gets its own conference information.
+	auto confInfo1 = Ics::Icalendar::createFromString(str)->toConferenceInfo();
+	auto confInfo2 = Ics::Icalendar::createFromString(str)->toConferenceInfo();
+	BC_ASSERT_TRUE(confInfo1 != confInfo2);
+	BC_ASSERT_STRING_EQUAL(confInfo1->getSubject().c_str(), "Parser benchmark");
+	BC_ASSERT_EQUAL(confInfo1->getIcsSequence(), 3, int, "%d");
+	confInfo1->setSubject("Changed");
+	BC_ASSERT_STRING_EQUAL(confInfo2->getSubject().c_str(), "Parser benchmark");
+}
+
 static void conference_scheduler_invitations_sent(LinphoneConferenceScheduler *scheduler,
                                                   const bctbx_list_t *failed_addresses) {
 	stats *stat = get_stats(linphone_conference_scheduler_get_core(scheduler));
@@ -268,10 +344,24 @@ static void conference_scheduler_invitations_sent_with_error(LinphoneConferenceS
 	}
 }
 
+static void conference_scheduler_invitations_progress(LinphoneConferenceScheduler *scheduler,
+                                                      unsigned int processed_invitations,
+                                                      unsigned int total_invitations) {
+	stats *stat = get_stats(linphone_conference_scheduler_get_core(scheduler));
+	stat->number_of_ConferenceSchedulerInvitationsProgress++;
+	BC_ASSERT_EQUAL(processed_invitations, (unsigned int)stat->number_of_ConferenceSchedulerInvitationsProgress,
+	                unsigned int, "%u");
+	BC_ASSERT_LOWER(processed_invitations, total_invitations, unsigned int, "%u");
+	const unsigned int *expected_total = (const unsigned int *)linphone_conference_scheduler_cbs_get_user_data(
+	    linphone_conference_scheduler_get_current_callbacks(scheduler));
+	if (expected_total) BC_ASSERT_EQUAL(total_invitations, *expected_total, unsigned int, "%u");
+}
+
 static void send_conference_invitations(bool_t enable_encryption,
                                         const char *subject,
                                         int curveId,
-                                        bool_t add_participant_in_error) {
+                                        bool_t add_participant_in_error,
+                                        bool_t organizer_is_participant) {
 	bctbx_list_t *coresManagerList = NULL;
 	LinphoneCoreManager *marie = linphone_core_manager_create("marie_rc");
 	LinphoneCoreManager *pauline = linphone_core_manager_create("pauline_rc");
@@ -307,6 +397,10 @@ static void send_conference_invitations(bool_t enable_encryption,
 	linphone_conference_info_set_organizer(conf_info, marie->identity);
 	linphone_conference_info_add_participant(conf_info, pauline->identity);
 	linphone_conference_info_add_participant(conf_info, laure->identity);
+	if (organizer_is_participant) {
+		// No invitation is sent to ourselves, so the progress must still end at 2 out of 2 (or 3 out of 3).
+		linphone_conference_info_add_participant(conf_info, marie->identity);
+	}
 	if (add_participant_in_error) {
 		LinphoneAddress *error_participant = linphone_address_new("sip:error404@sip.example.org");
 		linphone_conference_info_add_participant(conf_info, error_participant);
@@ -319,6 +413,7 @@ static void send_conference_invitations(bool_t enable_encryption,
 
 	LinphoneAddress *conf_uri = linphone_address_new("sip:confvideo@sip.linphone.org");
 	linphone_conference_info_set_uri(conf_info, conf_uri);
+	const size_t expected_participants = 2 + (add_participant_in_error ? 1 : 0) + (organizer_is_participant ? 1 : 0);
 
 	LinphoneConferenceScheduler *conference_scheduler = linphone_core_create_conference_scheduler(marie->lc);
 	LinphoneConferenceSchedulerCbs *cbs = linphone_factory_create_conference_scheduler_cbs(linphone_factory_get());
@@ -327,11 +422,16 @@ static void send_conference_invitations(bool_t enable_encryption,
 	} else {
 		linphone_conference_scheduler_cbs_set_invitations_sent(cbs, conference_scheduler_invitations_sent);
 	}
+	linphone_conference_scheduler_cbs_set_invitations_progress(cbs, conference_scheduler_invitations_progress);
+	unsigned int expected_invitations = add_participant_in_error ? 3 : 2;
+	linphone_conference_scheduler_cbs_set_user_data(cbs, &expected_invitations);
 	linphone_conference_scheduler_add_callbacks(conference_scheduler, cbs);
 	linphone_conference_scheduler_cbs_unref(cbs);
 
 	linphone_conference_scheduler_set_info(conference_scheduler, conf_info);
 
+	// Send the invitations one after the other
+	linphone_config_set_int(linphone_core_get_config(marie->lc), "misc", "conference_invitations_max_in_flight", 1);
 	LinphoneChatRoomParams *chat_room_params = linphone_core_create_default_chat_room_params(marie->lc);
 	if (enable_encryption) {
 		linphone_chat_room_params_set_backend(chat_room_params, LinphoneChatRoomBackendFlexisipChat);
@@ -347,6 +447,8 @@ static void send_conference_invitations(bool_t enable_encryption,
 
 	BC_ASSERT_TRUE(
 	    wait_for_until(marie->lc, pauline->lc, &marie->stat.number_of_ConferenceSchedulerInvitationsSent, 1, 30000));
+	BC_ASSERT_EQUAL(marie->stat.number_of_ConferenceSchedulerInvitationsProgress, (int)expected_invitations, int,
+	                "%d");
 	linphone_conference_info_unref(conf_info);
 	linphone_conference_scheduler_unref(conference_scheduler);
 
@@ -370,11 +472,7 @@ static void send_conference_invitations(bool_t enable_encryption,
 			BC_ASSERT_TRUE(linphone_address_weak_equal(
 			    conf_uri, linphone_conference_info_get_uri(conf_info_from_original_content)));
 			bctbx_list_t *participants = linphone_conference_info_get_participants(conf_info_from_original_content);
-			if (add_participant_in_error) {
-				BC_ASSERT_EQUAL(bctbx_list_size(participants), 3, size_t, "%zu");
-			} else {
-				BC_ASSERT_EQUAL(bctbx_list_size(participants), 2, size_t, "%zu");
-			}
+			BC_ASSERT_EQUAL(bctbx_list_size(participants), expected_participants, size_t, "%zu");
 			bctbx_list_free(participants);
 			BC_ASSERT_EQUAL(linphone_conference_info_get_duration(conf_info_from_original_content), 120, int, "%d");
 			BC_ASSERT_TRUE(linphone_conference_info_get_date_time(conf_info_from_original_content) == conf_time);
@@ -426,11 +524,7 @@ static void send_conference_invitations(bool_t enable_encryption,
 			BC_ASSERT_TRUE(
 			    linphone_address_weak_equal(conf_uri, linphone_conference_info_get_uri(conf_info_from_content)));
 			bctbx_list_t *participants = linphone_conference_info_get_participants(conf_info_from_content);
-			if (add_participant_in_error) {
-				BC_ASSERT_EQUAL(bctbx_list_size(participants), 3, size_t, "%zu");
-			} else {
-				BC_ASSERT_EQUAL(bctbx_list_size(participants), 2, size_t, "%zu");
-			}
+			BC_ASSERT_EQUAL(bctbx_list_size(participants), expected_participants, size_t, "%zu");
 			bctbx_list_free(participants);
 			BC_ASSERT_EQUAL(linphone_conference_info_get_duration(conf_info_from_content), 120, int, "%d");
 			BC_ASSERT_TRUE(linphone_conference_info_get_date_time(conf_info_from_content) == conf_time);
@@ -460,21 +554,25 @@ static void send_conference_invitations(bool_t enable_encryption,
 }
 
 static void send_conference_invitations_1(void) {
-	send_conference_invitations(FALSE, NULL, 0, FALSE);
+	send_conference_invitations(FALSE, NULL, 0, FALSE, FALSE);
 }
 
 static void send_conference_invitations_2(void) {
-	send_conference_invitations(TRUE, "dummy subject", 25519, FALSE);
-	// send_conference_invitations(TRUE, "dummy subject", 448, FALSE);
+	send_conference_invitations(TRUE, "dummy subject", 25519, FALSE, FALSE);
+	// send_conference_invitations(TRUE, "dummy subject", 448, FALSE, FALSE);
+}
+
+static void send_conference_invitations_organizer_participant(void) {
+	send_conference_invitations(FALSE, NULL, 0, FALSE, TRUE);
 }
 
 static void send_conference_invitations_error_1(void) {
-	send_conference_invitations(FALSE, NULL, 0, TRUE);
+	send_conference_invitations(FALSE, NULL, 0, TRUE, FALSE);
 }
 
 static void send_conference_invitations_error_2(void) {
-	send_conference_invitations(TRUE, "dummy subject", 25519, TRUE);
-	// send_conference_invitations(TRUE, "dummy subject", 448, TRUE);
+	send_conference_invitations(TRUE, "dummy subject", 25519, TRUE, FALSE);
+	// send_conference_invitations(TRUE, "dummy subject", 448, TRUE, FALSE);
 }
 
 test_t ics_tests[] = {
@@ -482,8 +580,12 @@ test_t ics_tests[] = {
     TEST_NO_TAG("Parse RFC example", parse_rfc_example),
     TEST_NO_TAG("Parse folded example", parse_folded_example),
     TEST_NO_TAG("Build Ics", build_ics),
+    TEST_NO_TAG("Build Ics memoized", build_ics_memoized),
+    TEST_NO_TAG("Parse Ics benchmark", parse_ics_benchmark),
     TEST_NO_TAG("Send conference invitations in basic chat room", send_conference_invitations_1),
     TEST_NO_TAG("Send conference invitations in one-to-one encrypted chat room", send_conference_invitations_2),
+    TEST_NO_TAG("Send conference invitations to organizer participant",
+                send_conference_invitations_organizer_participant),
     TEST_NO_TAG("Send conference invitations error in basic chat room", send_conference_invitations_error_1),
     TEST_NO_TAG("Send conference invitations error in one-to-one encrypted chat room",
                 send_conference_invitations_error_2),
@@ -491,6 +491,7 @@ typedef struct _stats {
 	int number_of_ConferenceSchedulerStateUpdating;
 	int number_of_ConferenceSchedulerStateError;
 	int number_of_ConferenceSchedulerInvitationsSent;
+	int number_of_ConferenceSchedulerInvitationsProgress;
 
 	int number_of_LinphoneMagicSearchResultReceived;
 	int number_of_LinphoneMagicSearchLdapHaveMoreResults;
@@ -28,6 +28,7 @@
 #include "c-wrapper/c-wrapper.h"
 #include "chat/chat-room/chat-room.h"
 #include "chat/chat-room/server-group-chat-room-p.h"
+#include "conference/conference.h"
 #include "conference/participant.h"
 #include "core/core.h"
 #include "liblinphone_tester++.h"
@@ -1948,6 +1949,117 @@ static void group_chat_room_with_client_restart(void) {
 	}
 }
 
+static void group_chat_room_list_subscription_in_chunks(void) {
+	Focus focus("chloe_rc");
+	{ // to make sure focus is destroyed after clients.
+		ClientConference marie("marie_rc", focus.getIdentity());
+		ClientConference michelle("michelle_rc", focus.getIdentity());
+
+		focus.registerAsParticipantDevice(marie);
+		focus.registerAsParticipantDevice(michelle);
+
+		// Handle the conferences of a list subscription two by two
+		linphone_config_set_int(linphone_core_get_config(focus.getLc()), "misc", "conference_list_notify_chunk_size",
+		                        2);
+
+		bctbx_list_t *coresList = bctbx_list_append(NULL, focus.getLc());
+		coresList = bctbx_list_append(coresList, marie.getLc());
+		coresList = bctbx_list_append(coresList, michelle.getLc());
+		bctbx_list_t *participantsAddresses = NULL;
+		Address michelleAddr = michelle.getIdentity();
+		participantsAddresses = bctbx_list_append(participantsAddresses, linphone_address_ref(michelleAddr.toC()));
+
+		// Marie creates more group chat rooms than a chunk holds
+		const int nbChatRooms = 5;
+		for (int i = 0; i < nbChatRooms; i++) {
+			stats initialMarieStats = marie.getStats();
+			stats initialMichelleStats = michelle.getStats();
+			char *subject = bctbx_strdup_printf("Colleagues %d", i);
+			LinphoneChatRoom *marieCr = create_chat_room_client_side_with_expected_number_of_participants(
+			    coresList, marie.getCMgr(), &initialMarieStats, participantsAddresses, subject, 1, FALSE,
+			    LinphoneChatRoomEphemeralModeDeviceManaged);
+			const LinphoneAddress *confAddr = linphone_chat_room_get_conference_address(marieCr);
+			check_creation_chat_room_client_side(coresList, michelle.getCMgr(), &initialMichelleStats, confAddr,
+			                                     subject, 1, FALSE);
+			bctbx_free(subject);
+		}
+		bctbx_list_free_with_data(participantsAddresses, (bctbx_list_free_func)linphone_address_unref);
+
+		BC_ASSERT_TRUE(CoreManagerAssert({focus, marie, michelle}).wait([&focus] {
+			for (auto chatRoom : focus.getCore().getChatRooms()) {
+				for (auto participant : chatRoom->getParticipants()) {
+					for (auto device : participant->getDevices())
+						if (device->getState() != ParticipantDevice::State::Present) {
+							return false;
+						}
+				}
+			}
+			return true;
+		}));
+		BC_ASSERT_EQUAL((int)focus.getCore().getChatRooms().size(), nbChatRooms, int, "%d");
+
+		// Michelle restarts and asks for the full state of every chat room through a single list subscription
+		linphone_core_enter_background(michelle.getLc());
+		linphone_config_set_bool(linphone_core_get_config(michelle.getLc()), "misc",
+		                         "conference_event_package_force_full_state", TRUE);
+		coresList = bctbx_list_remove(coresList, michelle.getLc());
+		michelle.reStart();
+		coresList = bctbx_list_append(coresList, michelle.getLc());
+
+		// Wait for chat rooms to be recovered from the main DB
+		BC_ASSERT_TRUE(wait_for_list(coresList, &michelle.getStats().number_of_LinphoneConferenceStateCreated,
+		                             nbChatRooms, liblinphone_tester_sip_timeout));
+
+		// Every chat room must be synchronized with the server, hence every part reached Michelle
+		BC_ASSERT_TRUE(CoreManagerAssert({focus, marie, michelle}).wait([&focus, &michelle] {
+			auto chatRooms = michelle.getCore().getChatRooms();
+			if ((int)chatRooms.size() != nbChatRooms) return false;
+			for (auto chatRoom : chatRooms) {
+				const auto &peerAddress = chatRoom->getConferenceId().getPeerAddress();
+				auto focusChatRoom = focus.getCore().findChatRoom(ConferenceId(peerAddress, peerAddress), false);
+				if (!focusChatRoom) return false;
+				unsigned int lastNotify = chatRoom->getConference()->getLastNotify();
+				if ((lastNotify == 0) || (lastNotify != focusChatRoom->getConference()->getLastNotify())) {
+					return false;
+				}
+			}
+			return true;
+		}));
+
+		// wait bit more to detect side effect if any
+		CoreManagerAssert({focus, marie, michelle}).waitUntil(chrono::seconds(2), [] { return false; });
+		// All the chunks are gathered in one NOTIFY
+		BC_ASSERT_EQUAL(michelle.getStats().number_of_NotifyReceived, 1, int, "%d");
+
+		linphone_config_set_bool(linphone_core_get_config(michelle.getLc()), "misc",
+		                         "conference_event_package_force_full_state", FALSE);
+
+		for (auto chatRoom : focus.getCore().getChatRooms()) {
+			for (auto participant : chatRoom->getParticipants()) {
+				//  force deletion by removing devices
+				std::shared_ptr<Address> participantAddress = participant->getAddress();
+				linphone_chat_room_set_participant_devices(L_GET_C_BACK_PTR(chatRoom), participantAddress->toC(), NULL);
+			}
+		}
+
+		// wait until chatroom is deleted server side
+		BC_ASSERT_TRUE(CoreManagerAssert({focus, marie, michelle}).wait([&focus] {
+			return focus.getCore().getChatRooms().size() == 0;
+		}));
+
+		// wait bit more to detect side effect if any
+		CoreManagerAssert({focus, marie, michelle}).waitUntil(chrono::seconds(2), [] { return false; });
+
+		// to avoid creation attempt of a new chatroom
+		auto config = focus.getDefaultProxyConfig();
+		linphone_proxy_config_edit(config);
+		linphone_proxy_config_set_conference_factory_uri(config, NULL);
+		linphone_proxy_config_done(config);
+
+		bctbx_list_free(coresList);
+	}
+}
+
 static void group_chat_room_with_client_removed_added(void) {
 	Focus focus("chloe_rc");
 	{ // to make sure focus is destroyed after clients.
@@ -15497,6 +15609,9 @@ static test_t local_conference_chat_tests[] = {
     TEST_ONE_TAG("Group chat with client restart",
                  LinphoneTest::group_chat_room_with_client_restart,
                  "LeaksMemory"), /* beacause of coreMgr restart*/
+    TEST_ONE_TAG("Group chat list subscription in chunks",
+                 LinphoneTest::group_chat_room_list_subscription_in_chunks,
+                 "LeaksMemory"), /* beacause of coreMgr restart*/
     TEST_ONE_TAG("Group chat with INVITE session error",
                  LinphoneTest::group_chat_room_with_invite_error,
                  "LeaksMemory"), /* because of network up and down */
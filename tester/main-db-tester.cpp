@@ -18,8 +18,13 @@
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#ifdef HAVE_SOCI
+#include <soci/soci.h>
+#endif
+
 #include "address/address.h"
 #include "core/core-p.h"
+#include "db/internal/statements.h"
 #include "db/main-db.h"
 #include "event-log/events.h"
 
@@ -61,6 +66,10 @@ public:
 		return *L_GET_PRIVATE(mCoreManager->lc->cppPtr)->mainDb;
 	}
 
+	CorePrivate *getCorePrivate() {
+		return L_GET_PRIVATE(mCoreManager->lc->cppPtr);
+	}
+
 private:
 	LinphoneCoreManager *mCoreManager;
 };
@@ -270,13 +279,203 @@ static void load_a_lot_of_chatrooms(void) {
 #endif
 }
 
+static void expire_a_lot_of_ephemeral_messages(void) {
+#ifdef HAVE_SOCI
+	const int messageCount = 100000;
+	MainDbProvider provider("db/chatrooms.db");
+	MainDb &mainDb = provider.getMainDb();
+	const int initialCount = mainDb.getChatMessageCount();
+
+	char *dbPath = bc_tester_file("linphone.db");
+	{
+		// Clone an existing message many times, all the clones have already expired.
+		soci::session sql("sqlite3", dbPath);
+		long long templateId = -1, chatRoomId = -1, maxId = -1;
+		sql << "SELECT event_id, chat_room_id FROM conference_chat_message_event"
+		       " JOIN conference_event USING (event_id) LIMIT 1",
+		    soci::into(templateId), soci::into(chatRoomId);
+		sql << "SELECT MAX(id) FROM event", soci::into(maxId);
+
+		soci::transaction tr(sql);
+		sql << "WITH RECURSIVE seq(n) AS (SELECT 1 UNION ALL SELECT n + 1 FROM seq WHERE n < :count)"
+		       " INSERT INTO event (type, creation_time) SELECT type, creation_time FROM event, seq WHERE id = :id",
+		    soci::use(messageCount), soci::use(templateId);
+		sql << "INSERT INTO conference_event (event_id, chat_room_id) SELECT id, :chatRoomId FROM event WHERE id > :id",
+		    soci::use(chatRoomId), soci::use(maxId);
+		sql << "INSERT INTO conference_chat_message_event (event_id, from_sip_address_id, to_sip_address_id, time,"
+		       " imdn_message_id, state, direction, is_secured)"
+		       " SELECT event.id, from_sip_address_id, to_sip_address_id, time, 'ephemeral-' || event.id, state,"
+		       " direction, is_secured FROM event, conference_chat_message_event WHERE event.id > :id AND event_id = "
+		       ":templateId",
+		    soci::use(maxId), soci::use(templateId);
+		sql << "INSERT INTO chat_message_ephemeral_event (event_id, ephemeral_lifetime, expired_time)"
+		       " SELECT id, 1, :expireTime FROM event WHERE id > :id",
+		    soci::use(Utils::getTimeTAsTm(ms_time(NULL) - 10)), soci::use(maxId);
+		tr.commit();
+	}
+	bc_free(dbPath);
+	BC_ASSERT_EQUAL(mainDb.getChatMessageCount(), initialCount + messageCount, int, "%d");
+
+	uint64_t startTime = bctbx_get_cur_time_ms();
+	provider.getCorePrivate()->initEphemeralMessages();
+	ms_message("Loaded %d ephemeral messages in %d ms", messageCount, (int)(bctbx_get_cur_time_ms() - startTime));
+
+	startTime = bctbx_get_cur_time_ms();
+	provider.getCorePrivate()->handleEphemeralMessages(ms_time(NULL));
+	ms_message("Deleted %d ephemeral messages in %d ms", messageCount, (int)(bctbx_get_cur_time_ms() - startTime));
+	BC_ASSERT_TRUE(mainDb.getEphemeralMessageExpireTimes().empty());
+	BC_ASSERT_EQUAL(mainDb.getChatMessageCount(), initialCount, int, "%d");
+#endif
+}
+
+static void get_call_history_pages(void) {
+	MainDbProvider provider;
+	MainDb &mainDb = provider.getMainDb();
+	mainDb.deleteCallHistory();
+
+	// 25 calls with 3 peers, alternatively incoming and outgoing, one incoming call out of two is missed.
+	// Calls start one second after the other, except the calls 10 to 14 that started in the same second.
+	const auto local = Address::create("sip:test-1@sip.linphone.org");
+	const vector<shared_ptr<Address>> peers = {Address::create("sip:test-2@sip.linphone.org"),
+	                                           Address::create("sip:test-3@sip.linphone.org"),
+	                                           Address::create("sip:test-4@sip.linphone.org")};
+	const int callCount = 25;
+	const time_t startTime = ms_time(NULL) - 3600;
+	vector<shared_ptr<CallLog>> callLogs;
+	for (int i = 0; i < callCount; i++) {
+		const auto &peer = peers[(size_t)i % peers.size()];
+		const bool incoming = (i % 2 == 0);
+		auto callLog = CallLog::create(mainDb.getCore(), incoming ? LinphoneCallIncoming : LinphoneCallOutgoing,
+		                               incoming ? peer : local, incoming ? local : peer);
+		callLog->setCallId("call-history-page-" + to_string(i));
+		callLog->setStartTime(startTime + ((i >= 10 && i < 15) ? 10 : i));
+		callLog->setStatus(incoming && i % 4 == 0 ? LinphoneCallMissed : LinphoneCallSuccess);
+		mainDb.insertCallLog(callLog);
+		callLogs.push_back(callLog);
+	}
+	BC_ASSERT_EQUAL(mainDb.getCallHistorySize(), callCount, int, "%d");
+
+	// A call that failed before getting a Call-ID, inserted last but started before all the others.
+	auto failedCallLog = CallLog::create(mainDb.getCore(), LinphoneCallOutgoing, local, peers[0]);
+	failedCallLog->setStartTime(startTime - 1);
+	failedCallLog->setStatus(LinphoneCallAborted);
+	mainDb.insertCallLog(failedCallLog);
+	BC_ASSERT_EQUAL(mainDb.getCallHistorySize(), callCount + 1, int, "%d");
+
+	int expectedIndex = callCount - 1;
+	shared_ptr<CallLog> after = nullptr;
+	// Page boundaries fall inside the calls sharing the same start time, then on the call without Call-ID.
+	for (size_t expectedSize : {12, 12, 2, 0}) {
+		auto page = mainDb.getCallHistoryPage(after, 12);
+		BC_ASSERT_EQUAL(page.size(), expectedSize, size_t, "%zu");
+		for (const auto &callLog : page) {
+			if (expectedIndex >= 0) BC_ASSERT_TRUE(callLog == callLogs[(size_t)expectedIndex]);
+			else BC_ASSERT_TRUE(callLog == failedCallLog);
+			expectedIndex--;
+		}
+		if (!page.empty()) after = page.back();
+	}
+	BC_ASSERT_EQUAL(expectedIndex, -2, int, "%d");
+
+	// Peers are sorted by their last stored call.
+	auto summaries = mainDb.getCallHistorySummaries(nullptr, 2);
+	if (BC_ASSERT_EQUAL(summaries.size(), 2, size_t, "%zu")) {
+		BC_ASSERT_TRUE(summaries.front().lastCallLog == failedCallLog);
+		BC_ASSERT_EQUAL(summaries.front().callCount, 10, int, "%d");
+		BC_ASSERT_EQUAL(summaries.front().missedCallCount, 3, int, "%d");
+		BC_ASSERT_STRING_EQUAL(summaries.back().lastCallLog->getCallId().c_str(), "call-history-page-23");
+		BC_ASSERT_EQUAL(summaries.back().callCount, 8, int, "%d");
+		BC_ASSERT_EQUAL(summaries.back().missedCallCount, 2, int, "%d");
+
+		summaries = mainDb.getCallHistorySummaries(summaries.back().lastCallLog, 2);
+		if (BC_ASSERT_EQUAL(summaries.size(), 1, size_t, "%zu")) {
+			BC_ASSERT_STRING_EQUAL(summaries.front().lastCallLog->getCallId().c_str(), "call-history-page-22");
+			BC_ASSERT_EQUAL(summaries.front().callCount, 8, int, "%d");
+			BC_ASSERT_EQUAL(summaries.front().missedCallCount, 2, int, "%d");
+		}
+	}
+}
+
+// Returns true if the plan of the query reads a whole table instead of searching it with an index.
+static bool query_plan_has_full_scan(const char *dbPath, const string &query) {
+	bool fullScan = false;
+#ifdef HAVE_SOCI
+	soci::session sql("sqlite3", dbPath);
+	soci::rowset<soci::row> rows = (sql.prepare << "EXPLAIN QUERY PLAN " + query);
+	for (const auto &row : rows) {
+		// Last column is the detail, like "SEARCH event USING INTEGER PRIMARY KEY (rowid=?)" or "SCAN event".
+		const string detail = row.get<string>(row.size() - 1);
+		ms_message("  %s", detail.c_str());
+		if (detail.rfind("SCAN", 0) == 0 && detail.find("USING") == string::npos) fullScan = true;
+	}
+#endif
+	return fullScan;
+}
+
+// Returns true if the plan of the query searches the given index.
+static bool query_plan_uses_index(const char *dbPath, const string &query, const string &index) {
+	bool found = false;
+#ifdef HAVE_SOCI
+	soci::session sql("sqlite3", dbPath);
+	soci::rowset<soci::row> rows = (sql.prepare << "EXPLAIN QUERY PLAN " + query);
+	for (const auto &row : rows) {
+		const string detail = row.get<string>(row.size() - 1);
+		ms_message("  %s", detail.c_str());
+		if (detail.find("INDEX " + index) != string::npos) found = true;
+	}
+#else
+	found = true;
+#endif
+	return found;
+}
+
+static void query_plans(void) {
+	MainDbProvider provider("db/chatrooms.db");
+	char *dbPath = bc_tester_file("linphone.db");
+
+	for (int i = 0; i < Statements::SelectCount; i++) {
+		ms_message("Query plan of statement %d:", i);
+		query_plan_has_full_scan(dbPath, Statements::get(static_cast<Statements::Select>(i)));
+	}
+
+	// These queries are run on every push notification, IMDN and call log update, they must stay indexed.
+	const vector<string> hotQueries = {
+	    Statements::get(Statements::SelectSipAddressId),
+	    Statements::get(Statements::SelectChatRoomId),
+	    Statements::get(Statements::SelectConferenceEvent) + string(" WHERE conference_event_view.id = :1"),
+	    Statements::get(Statements::SelectConferenceCall),
+	    Statements::get(Statements::SelectChatMessageEventsFromCallId),
+	    Statements::get(Statements::SelectConferenceEvents) + string(" AND imdn_message_id = :2")};
+	for (const auto &query : hotQueries) {
+		ms_message("Query plan of hot query:");
+		BC_ASSERT_FALSE(query_plan_has_full_scan(dbPath, query));
+	}
+
+	// Messages and calls are looked up by call id or IMDN message id, whatever their chat room.
+	const vector<pair<string, string>> indexedQueries = {
+	    {Statements::get(Statements::SelectChatMessageEventsFromCallId), "chat_message_call_id_index"},
+	    {"SELECT event_id FROM conference_chat_message_event WHERE imdn_message_id = :1",
+	     "chat_message_imdn_message_id_index"},
+	    {Statements::get(Statements::SelectConferenceCall), "conference_call_call_id_index"}};
+	for (const auto &query : indexedQueries) {
+		ms_message("Query plan expected to use %s:", query.second.c_str());
+		BC_ASSERT_TRUE(query_plan_uses_index(dbPath, query.first, query.second));
+	}
+	bc_free(dbPath);
+}
+
 test_t main_db_tests[] = {TEST_NO_TAG("Get events count", get_events_count),
                           TEST_NO_TAG("Get messages count", get_messages_count),
                           TEST_NO_TAG("Get unread messages count", get_unread_messages_count),
                           TEST_NO_TAG("Get history", get_history),
                           TEST_NO_TAG("Get conference events", get_conference_notified_events),
                           TEST_NO_TAG("Get chat rooms", get_chat_rooms),
-                          TEST_NO_TAG("Load a lot of chatrooms", load_a_lot_of_chatrooms)};
+                          TEST_NO_TAG("Get call history pages", get_call_history_pages),
+                          TEST_NO_TAG("Load a lot of chatrooms", load_a_lot_of_chatrooms),
+                          TEST_NO_TAG("Query plans", query_plans),
+                          TEST_ONE_TAG("Expire a lot of ephemeral messages",
+                                       expire_a_lot_of_ephemeral_messages,
+                                       "Ephemeral")};
 
 test_suite_t main_db_test_suite = {"MainDb",
                                    NULL,
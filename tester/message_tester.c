@@ -1785,6 +1785,85 @@ static void transfer_message_with_download_io_error(void) {
 	transfer_message_base(FALSE, TRUE, FALSE, FALSE, FALSE, TRUE, -1, FALSE, FALSE);
 }
 
+static void resumed_download_progress_indication(LinphoneChatMessage *msg,
+                                                 LinphoneContent *content,
+                                                 size_t offset,
+                                                 size_t total) {
+	size_t *first_offset = (size_t *)linphone_chat_message_get_user_data(msg);
+	if (first_offset && *first_offset == 0) *first_offset = offset;
+	file_transfer_progress_indication(msg, content, offset, total);
+}
+
+static size_t get_file_size(const char *path) {
+	size_t size = 0;
+	FILE *file = fopen(path, "rb");
+	if (file) {
+		fseek(file, 0, SEEK_END);
+		size = (size_t)ftell(file);
+		fclose(file);
+	}
+	return size;
+}
+
+static void transfer_message_download_resumed_after_io_error(void) {
+	LinphoneCoreManager *marie = linphone_core_manager_new("marie_rc");
+	LinphoneCoreManager *pauline = linphone_core_manager_new("pauline_tcp_rc");
+	char *send_filepath = bc_tester_res("sounds/sintel_trailer_opus_h264.mkv");
+	char *receive_filepath = bc_tester_file("receive_file_resumed.dump");
+	size_t first_resumed_offset = 0;
+	remove(receive_filepath);
+
+	/* Globally configure an http file transfer server. */
+	linphone_core_set_file_transfer_server(pauline->lc, file_transfer_url);
+
+	LinphoneChatRoom *chat_room = linphone_core_get_chat_room(pauline->lc, marie->identity);
+	LinphoneChatMessage *msg = create_message_from_sintel_trailer(chat_room);
+	linphone_chat_message_send(msg);
+
+	BC_ASSERT_TRUE(
+	    wait_for_until(pauline->lc, marie->lc, &marie->stat.number_of_LinphoneMessageReceivedWithFile, 1, 60000));
+
+	LinphoneChatMessage *recv_msg = marie->stat.last_received_chat_message;
+	if (BC_ASSERT_PTR_NOT_NULL(recv_msg)) {
+		LinphoneChatMessageCbs *cbs = linphone_factory_create_chat_message_cbs(linphone_factory_get());
+		linphone_chat_message_cbs_set_msg_state_changed(cbs, liblinphone_tester_chat_message_msg_state_changed);
+		linphone_chat_message_cbs_set_file_transfer_progress_indication(cbs, resumed_download_progress_indication);
+		linphone_chat_message_add_callbacks(recv_msg, cbs);
+		linphone_chat_message_cbs_unref(cbs);
+		linphone_chat_message_set_file_transfer_filepath(recv_msg, receive_filepath);
+		linphone_chat_message_download_file(recv_msg);
+
+		/* wait for file to be 50% downloaded and simulate network error */
+		BC_ASSERT_TRUE(wait_for(pauline->lc, marie->lc, &marie->stat.progress_of_LinphoneFileTransfer, 50));
+		belle_http_provider_set_recv_error(linphone_core_get_http_provider(marie->lc), -1);
+		BC_ASSERT_TRUE(
+		    wait_for_until(marie->lc, pauline->lc, &marie->stat.number_of_LinphoneMessageFileTransferError, 1, 10000));
+		belle_http_provider_set_recv_error(linphone_core_get_http_provider(marie->lc), 0);
+
+		size_t partial_size = get_file_size(receive_filepath);
+		BC_ASSERT_GREATER(partial_size, 1, size_t, "%zu");
+		BC_ASSERT_LOWER(partial_size, get_file_size(send_filepath) - 1, size_t, "%zu");
+
+		/* Download again: the request carries a Range header and the server answers with the missing bytes only,
+		 * so the first progress notification already accounts for the bytes kept from the interrupted download. */
+		linphone_chat_message_set_user_data(recv_msg, &first_resumed_offset);
+		linphone_chat_message_download_file(recv_msg);
+		if (BC_ASSERT_TRUE(wait_for_until(pauline->lc, marie->lc,
+		                                  &marie->stat.number_of_LinphoneFileTransferDownloadSuccessful, 1, 55000))) {
+			BC_ASSERT_GREATER(first_resumed_offset, partial_size, size_t, "%zu");
+			compare_files(send_filepath, receive_filepath);
+		}
+		linphone_chat_message_set_user_data(recv_msg, NULL);
+	}
+
+	remove(receive_filepath);
+	bc_free(receive_filepath);
+	bc_free(send_filepath);
+	linphone_chat_message_unref(msg);
+	linphone_core_manager_destroy(marie);
+	linphone_core_manager_destroy(pauline);
+}
+
 static void transfer_message_upload_cancelled(void) {
 	if (transport_supported(LinphoneTransportTls)) {
 		LinphoneCoreManager *marie = linphone_core_manager_new("marie_rc");
@@ -3839,6 +3918,7 @@ test_t message_tests[] = {
     TEST_NO_TAG("Transfer message with http proxy", file_transfer_with_http_proxy),
     TEST_NO_TAG("Transfer message with upload io error", transfer_message_with_upload_io_error),
     TEST_NO_TAG("Transfer message with download io error", transfer_message_with_download_io_error),
+    TEST_NO_TAG("Transfer message download resumed after io error", transfer_message_download_resumed_after_io_error),
     TEST_NO_TAG("Transfer message upload cancelled", transfer_message_upload_cancelled),
     TEST_NO_TAG("Transfer message upload finished during stop", transfer_message_upload_finished_during_stop),
     TEST_NO_TAG("Transfer message download cancelled", transfer_message_download_cancelled),
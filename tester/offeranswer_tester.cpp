@@ -18,13 +18,17 @@
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include "c-wrapper/c-wrapper.h"
+#include "core/core.h"
 #include "liblinphone_tester.h"
 #include "linphone/core.h"
 #include "linphone/lpconfig.h"
 #include "linphone/utils/utils.h"
+#include "sal/offeranswer.h"
 #include "sal/sal_media_description.h"
 #include "sal/sal_stream_description.h"
 #include "tester_utils.h"
+#include "utils/payload-type-handler.h"
 #include <sys/stat.h>
 #include <sys/types.h>
 
@@ -61,6 +65,136 @@ static void start_with_no_config(void) {
 	linphone_core_unref(lc);
 }
 
+static std::string create_sdp_with_streams(int streamCount) {
+	std::string sdp = "v=0\r\n"
+	                  "o=marie 1239 1239 IN IP4 192.168.0.18\r\n"
+	                  "s=Talk\r\n"
+	                  "c=IN IP4 192.168.0.18\r\n"
+	                  "t=0 0\r\n";
+	for (int i = 0; i < streamCount; i++) {
+		sdp += "m=audio " + std::to_string(7078 + 2 * i) + " RTP/AVP 0 8 96 97 101\r\n"
+		       "a=rtpmap:96 speex/16000\r\n"
+		       "a=rtpmap:97 speex/8000\r\n"
+		       "a=rtpmap:101 telephone-event/8000\r\n"
+		       "a=label:" + std::to_string(i) + "\r\n";
+	}
+	return sdp;
+}
+
+/* Parses and answers a SDP offer with many streams to measure the cost of the SDP model */
+static void parse_and_answer_offer_with_many_streams(void) {
+	const int streamCount = 10;
+	const int iterations = 100;
+	LinphoneCore *lc =
+	    linphone_factory_create_core_3(linphone_factory_get(), NULL, liblinphone_tester_get_empty_rc(), system_context);
+	MSFactory *factory = linphone_core_get_ms_factory(lc);
+	const std::string sdp = create_sdp_with_streams(streamCount);
+
+	belle_sdp_session_description_t *localSdp = belle_sdp_session_description_parse(sdp.c_str());
+	BC_ASSERT_PTR_NOT_NULL(localSdp);
+	if (!localSdp) goto end;
+	{
+		auto localCapabilities = std::make_shared<SalMediaDescription>(localSdp);
+		belle_sip_object_unref(localSdp);
+
+		std::shared_ptr<SalMediaDescription> answer;
+		uint64_t start = bctbx_get_cur_time_ms();
+		for (int i = 0; i < iterations; i++) {
+			belle_sdp_session_description_t *remoteSdp = belle_sdp_session_description_parse(sdp.c_str());
+			auto remoteOffer = std::make_shared<SalMediaDescription>(remoteSdp);
+			belle_sip_object_unref(remoteSdp);
+			answer = OfferAnswerEngine::initiateIncoming(factory, localCapabilities, remoteOffer, FALSE);
+		}
+		uint64_t elapsed = bctbx_get_cur_time_ms() - start;
+		ms_message("Parsed and answered %d offers of %d streams in %llu ms", iterations, streamCount,
+		           (unsigned long long)elapsed);
+
+		BC_ASSERT_EQUAL(answer->getNbStreams(), (size_t)streamCount, size_t, "%zu");
+		for (const auto &stream : answer->streams) {
+			BC_ASSERT_TRUE(stream.enabled());
+			BC_ASSERT_FALSE(stream.getPayloads().empty());
+		}
+
+		// Moving a media description hands its streams over without cloning them
+		SalMediaDescription copy(*answer);
+		SalMediaDescription moved(std::move(copy));
+		BC_ASSERT_TRUE(moved == *answer);
+		BC_ASSERT_EQUAL(copy.getNbStreams(), 0, size_t, "%zu");
+	}
+end:
+	linphone_core_unref(lc);
+}
+
+static bool has_payload_type(const std::list<OrtpPayloadType *> &payloads, const OrtpPayloadType *pt) {
+	for (const auto &candidate : payloads) {
+		if ((strcasecmp(candidate->mime_type, pt->mime_type) == 0) && (candidate->clock_rate == pt->clock_rate))
+			return true;
+	}
+	return false;
+}
+
+/*
+ * The codec lists are memoized by a PayloadTypeHandler, which lives for one local media description build. Streams with
+ * the same constraints get equal lists, other constraints get their own list, and a new build sees codec changes.
+ */
+static void codecs_list_memoized_per_description(void) {
+	LinphoneCore *lc =
+	    linphone_factory_create_core_3(linphone_factory_get(), NULL, liblinphone_tester_get_empty_rc(), system_context);
+	std::shared_ptr<Core> core = L_GET_CPP_PTR_FROM_C_OBJECT(lc)->getSharedFromThis();
+	const std::list<OrtpPayloadType *> noPreviousList;
+	OrtpPayloadType *disabledPt = nullptr;
+	{
+		PayloadTypeHandler handler(core);
+		std::list<OrtpPayloadType *> codecs1 = handler.makeCodecsList(SalAudio, 0, -1, noPreviousList, false);
+		std::list<OrtpPayloadType *> codecs2 = handler.makeCodecsList(SalAudio, 0, -1, noPreviousList, false);
+		BC_ASSERT_FALSE(codecs1.empty());
+		BC_ASSERT_EQUAL(codecs1.size(), codecs2.size(), size_t, "%zu");
+		for (auto it1 = codecs1.cbegin(), it2 = codecs2.cbegin(); it1 != codecs1.cend() && it2 != codecs2.cend();
+		     ++it1, ++it2) {
+			// Each stream owns its own copy of the payload types.
+			BC_ASSERT_PTR_NOT_EQUAL(*it1, *it2);
+			BC_ASSERT_STRING_EQUAL((*it1)->mime_type, (*it2)->mime_type);
+			BC_ASSERT_EQUAL(payload_type_get_number(*it1), payload_type_get_number(*it2), int, "%d");
+		}
+
+		// Numbers assigned by a previous offer are kept, the memoized list is not used for them.
+		for (const auto &pt : codecs1) {
+			if (payload_type_get_number(pt) < 96) continue;
+			std::list<OrtpPayloadType *> previousList{payload_type_clone(pt)};
+			const int previousNumber = (payload_type_get_number(pt) == 127) ? 126 : 127;
+			payload_type_set_number(previousList.front(), previousNumber);
+			std::list<OrtpPayloadType *> codecs3 = handler.makeCodecsList(SalAudio, 0, -1, previousList, false);
+			bool found = false;
+			for (const auto &pt3 : codecs3) {
+				if ((strcasecmp(pt3->mime_type, pt->mime_type) == 0) && (pt3->clock_rate == pt->clock_rate)) {
+					BC_ASSERT_EQUAL(payload_type_get_number(pt3), previousNumber, int, "%d");
+					found = true;
+				}
+			}
+			BC_ASSERT_TRUE(found);
+			PayloadTypeHandler::clearPayloadList(codecs3);
+			PayloadTypeHandler::clearPayloadList(previousList);
+			break;
+		}
+
+		// A codec is disabled between two builds.
+		disabledPt = linphone_core_find_payload_type(lc, codecs1.front()->mime_type, codecs1.front()->clock_rate,
+		                                             codecs1.front()->channels);
+		PayloadTypeHandler::clearPayloadList(codecs1);
+		PayloadTypeHandler::clearPayloadList(codecs2);
+	}
+	BC_ASSERT_PTR_NOT_NULL(disabledPt);
+	if (disabledPt) {
+		linphone_core_enable_payload_type(lc, disabledPt, FALSE);
+		PayloadTypeHandler handler(core);
+		std::list<OrtpPayloadType *> codecs = handler.makeCodecsList(SalAudio, 0, -1, noPreviousList, false);
+		BC_ASSERT_FALSE(has_payload_type(codecs, disabledPt));
+		PayloadTypeHandler::clearPayloadList(codecs);
+	}
+	core = nullptr;
+	linphone_core_unref(lc);
+}
+
 static void check_payload_type_numbers(LinphoneCall *call1, LinphoneCall *call2, int expected_number) {
 	const LinphoneCallParams *params = linphone_call_get_current_params(call1);
 	if (!BC_ASSERT_PTR_NOT_NULL(params)) return;
@@ -914,6 +1048,8 @@ end:
 
 static test_t offeranswer_tests[] = {
     TEST_NO_TAG("Start with no config", start_with_no_config),
+    TEST_NO_TAG("Parse and answer offer with many streams", parse_and_answer_offer_with_many_streams),
+    TEST_NO_TAG("Codecs list memoized per description", codecs_list_memoized_per_description),
     TEST_NO_TAG("Call failed because of codecs", call_failed_because_of_codecs),
     TEST_NO_TAG("Simple call with different codec mappings", simple_call_with_different_codec_mappings),
     TEST_NO_TAG("Simple call with fmtps", simple_call_with_fmtps),
@@ -18,6 +18,8 @@
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <sstream>
+
 #include "liblinphone_tester.h"
 #include "sal/potential_config_graph.h"
 
@@ -2330,6 +2332,75 @@ static void test_with_complex_sdp_and_multiple_acfg(void) {
 	                                {3, 4, 3}, {5, 13, 8}, {true, true, false}, {true, false, true});
 }
 
+static std::string createSdpWithManyPotentialConfigurations(const unsigned int noCaps, const unsigned int noCfgs) {
+	std::ostringstream sdp;
+	sdp << "v=0\r\n"
+	    << "o=jehan-mac 1239 1239 IN IP6 2a01:e35:1387:1020:6233:4bff:fe0b:5663\r\n"
+	    << "s=SIP Talk\r\n"
+	    << "c=IN IP4 192.168.0.18\r\n"
+	    << "t=0 0\r\n"
+	    << "m=audio 7078 RTP/AVP 111 110 3 0 8 101\r\n"
+	    << "a=rtpmap:111 speex/16000\r\n";
+	std::ostringstream acapAlternatives;
+	std::ostringstream tcapAlternatives;
+	for (unsigned int idx = 1; idx <= noCaps; idx++) {
+		sdp << "a=acap:" << idx << " ptime:" << (10 + idx) << "\r\n";
+		sdp << "a=tcap:" << idx << " RTP/SAVP\r\n";
+		acapAlternatives << ((idx == 1) ? "" : "|") << idx;
+		tcapAlternatives << ((idx == 1) ? "" : "|") << idx;
+	}
+	// Least preferred configurations come first so that they have to be evicted
+	for (unsigned int idx = noCfgs; idx >= 1; idx--) {
+		sdp << "a=pcfg:" << idx << " a=" << acapAlternatives.str() << " t=" << tcapAlternatives.str() << "\r\n";
+	}
+	// Configurations referencing out of range capabilities must be rejected without affecting the valid ones
+	sdp << "a=pcfg:" << (noCfgs + 1) << " a=99999999999999999999,1 t=0\r\n";
+	return sdp.str();
+}
+
+static void test_with_many_potential_configurations(void) {
+	const auto maxCfgs = PotentialCfgGraph::defaultMaxConfigurationsPerStream;
+	const unsigned int noCaps = 4 * maxCfgs;
+	const unsigned int noCfgs = 4 * maxCfgs;
+	const auto sdp = createSdpWithManyPotentialConfigurations(noCaps, noCfgs);
+	belle_sdp_session_description_t *sessionDescription = belle_sdp_session_description_parse(sdp.c_str());
+	BC_ASSERT_PTR_NOT_NULL(sessionDescription);
+	if (!sessionDescription) return;
+
+	uint64_t start = bctbx_get_cur_time_ms();
+	PotentialCfgGraph graph(sessionDescription);
+	BC_ASSERT_EQUAL(graph.getMaxConfigurationsPerStream(), maxCfgs, unsigned int, "%0u");
+	uint64_t elapsed = bctbx_get_cur_time_ms() - start;
+	ms_message("Built the potential configuration graph of %u acaps, %u tcaps and %u pcfgs in %llu ms", noCaps,
+	           noCaps, noCfgs, (unsigned long long)elapsed);
+
+	BC_ASSERT_EQUAL(graph.getMediaAcapForStream(0).size(), noCaps, std::size_t, "%0zu");
+	BC_ASSERT_EQUAL(graph.getMediaTcapForStream(0).size(), noCaps, std::size_t, "%0zu");
+
+	// Only the first configurations in index order are kept, each with a bounded number of alternatives
+	const auto &cfgs = graph.getCfgForStream(0);
+	BC_ASSERT_EQUAL(cfgs.size(), maxCfgs, std::size_t, "%0zu");
+	if (!cfgs.empty()) {
+		BC_ASSERT_EQUAL(cfgs.cbegin()->first, 1, unsigned int, "%0u");
+		BC_ASSERT_EQUAL(cfgs.crbegin()->first, maxCfgs, unsigned int, "%0u");
+	}
+	for (const auto &cfg : cfgs) {
+		BC_ASSERT_EQUAL(cfg.second.acap.size(), maxCfgs, std::size_t, "%0zu");
+		BC_ASSERT_EQUAL(cfg.second.tcap.size(), maxCfgs, std::size_t, "%0zu");
+		if (!cfg.second.acap.empty() && !cfg.second.acap.front().empty()) {
+			BC_ASSERT_EQUAL(cfg.second.acap.front().front().cap.lock()->index, 1, unsigned int, "%0u");
+		}
+	}
+
+	// Raising the bound of a graph makes every configuration available again, without changing the other graphs
+	PotentialCfgGraph unboundedGraph(sessionDescription, noCfgs + 1);
+	BC_ASSERT_EQUAL(unboundedGraph.getCfgForStream(0).size(), noCfgs, std::size_t, "%0zu");
+	PotentialCfgGraph defaultGraph(sessionDescription);
+	BC_ASSERT_EQUAL(defaultGraph.getCfgForStream(0).size(), maxCfgs, std::size_t, "%0zu");
+
+	belle_sip_object_unref(sessionDescription);
+}
+
 test_t potential_configuration_graph_tests[] = {
     TEST_NO_TAG("SDP with no capabilities", test_no_capabilities),
     TEST_NO_TAG("SDP with single capability in session", test_single_capability_in_session),
@@ -2409,6 +2480,7 @@ test_t potential_configuration_graph_tests[] = {
                 test_with_multiple_pcfg_with_media_session_delete_attribute),
     TEST_NO_TAG("SDP with complex SDP and multiple pcfgs", test_with_complex_sdp_and_multiple_pcfg),
     TEST_NO_TAG("SDP with complex SDP and multiple acfgs", test_with_complex_sdp_and_multiple_acfg),
+    TEST_NO_TAG("SDP with many potential configurations", test_with_many_potential_configurations),
 
 };
 
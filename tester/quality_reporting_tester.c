@@ -318,6 +318,77 @@ static void quality_reporting_interval_report(void) {
 	linphone_core_manager_destroy(pauline);
 }
 
+static int reports_made = 0;
+
+static void on_report_send_count(const LinphoneCall *call, SalStreamType stream_type, const LinphoneContent *content) {
+	on_report_send_mandatory(call, stream_type, content);
+	reports_made++;
+}
+
+static void quality_reporting_aggregated_reports(void) {
+	LinphoneCoreManager *marie = linphone_core_manager_new("marie_rc_rtcp_xr");
+	LinphoneCoreManager *pauline = linphone_core_manager_new("pauline_rc_rtcp_xr");
+	LinphoneCall *call_marie = NULL;
+	LinphoneCall *call_pauline = NULL;
+
+	linphone_config_set_int(linphone_core_get_config(marie->lc), "quality_reporting", "max_reports_per_publish", 3);
+	linphone_config_set_int(linphone_core_get_config(marie->lc), "quality_reporting", "publish_delay_ms", 60000);
+	reports_made = 0;
+
+	if (create_call_for_quality_reporting_tests(marie, pauline, &call_marie, &call_pauline, NULL, NULL)) {
+		linphone_reporting_set_on_report_send(call_marie, on_report_send_count);
+		LinphoneAccount *account = linphone_call_get_dest_account(call_marie);
+		LinphoneAccountParams *account_params = linphone_account_params_clone(linphone_account_get_params(account));
+		linphone_account_params_set_quality_reporting_interval(account_params, 1);
+		linphone_account_set_params(account, account_params);
+		linphone_account_params_unref(account_params);
+
+		// Three interval reports are needed before anything is published
+		BC_ASSERT_TRUE(wait_for_until(marie->lc, pauline->lc, &reports_made, 2, 60000));
+		BC_ASSERT_EQUAL(marie->stat.number_of_LinphonePublishProgress, 0, int, "%d");
+		BC_ASSERT_TRUE(
+		    wait_for_until(marie->lc, pauline->lc, &marie->stat.number_of_LinphonePublishProgress, 1, 60000));
+		BC_ASSERT_TRUE(wait_for_until(marie->lc, pauline->lc, &marie->stat.number_of_LinphonePublishOk, 1, 60000));
+		BC_ASSERT_GREATER(reports_made, 3 * marie->stat.number_of_LinphonePublishProgress, int, "%d");
+		end_call(marie, pauline);
+	}
+
+	linphone_core_manager_destroy(marie);
+	linphone_core_manager_destroy(pauline);
+}
+
+static void quality_reporting_sent_to_file_sink(void) {
+	LinphoneCoreManager *marie = linphone_core_manager_new("marie_quality_reporting_rc");
+	LinphoneCoreManager *pauline = linphone_core_manager_new("pauline_rc_rtcp_xr");
+	char *sink_path = bc_tester_file("quality-reports.txt");
+
+	unlink(sink_path);
+	linphone_config_set_string(linphone_core_get_config(marie->lc), "quality_reporting", "sink_file", sink_path);
+
+	if (create_call_for_quality_reporting_tests(marie, pauline, NULL, NULL, NULL, NULL)) {
+		linphone_core_terminate_all_calls(marie->lc);
+		BC_ASSERT_TRUE(wait_for_until(marie->lc, pauline->lc, &marie->stat.number_of_LinphoneCallReleased, 1, 10000));
+		BC_ASSERT_TRUE(wait_for_until(pauline->lc, NULL, &pauline->stat.number_of_LinphoneCallReleased, 1, 10000));
+
+		// The report is written to the file instead of being published
+		BC_ASSERT_EQUAL(marie->stat.number_of_LinphonePublishProgress, 0, int, "%d");
+		FILE *sink = fopen(sink_path, "rb");
+		BC_ASSERT_PTR_NOT_NULL(sink);
+		if (sink) {
+			char content[4096] = {0};
+			size_t read = fread(content, 1, sizeof(content) - 1, sink);
+			fclose(sink);
+			BC_ASSERT_GREATER_STRICT((int)read, 0, int, "%d");
+			BC_ASSERT_PTR_NOT_NULL(strstr(content, "VQSessionReport: CallTerm\r\n"));
+		}
+	}
+
+	unlink(sink_path);
+	bctbx_free(sink_path);
+	linphone_core_manager_destroy(marie);
+	linphone_core_manager_destroy(pauline);
+}
+
 #ifdef VIDEO_ENABLED
 static void quality_reporting_session_report_if_video_stopped(void) {
 	LinphoneCoreManager *marie = linphone_core_manager_new("marie_rc_rtcp_xr");
@@ -542,6 +613,7 @@ test_t quality_reporting_tests[] = {
     TEST_NO_TAG("Call term session report invalid if missing mandatory fields", quality_reporting_invalid_report),
     TEST_NO_TAG("Call term session report sent if call ended normally", quality_reporting_at_call_termination),
     TEST_NO_TAG("Interval report if interval is configured", quality_reporting_interval_report),
+    TEST_NO_TAG("Interval reports aggregated in fewer PUBLISH", quality_reporting_aggregated_reports),
     TEST_NO_TAG("Interval report if interval is configured with realtime text", quality_reporting_interval_report_rtt),
 #ifdef VIDEO_ENABLED
     TEST_NO_TAG("Interval report if interval is configured with video and realtime text",
@@ -549,6 +621,7 @@ test_t quality_reporting_tests[] = {
     TEST_NO_TAG("Session report sent if video stopped during call", quality_reporting_session_report_if_video_stopped),
 #endif // ifdef VIDEO_ENABLED
     TEST_NO_TAG("Sent using custom route", quality_reporting_sent_using_custom_route),
+    TEST_NO_TAG("Sent to file sink", quality_reporting_sent_to_file_sink),
     TEST_NO_TAG("Video bandwidth estimation", video_bandwidth_estimation)};
 
 test_suite_t quality_reporting_test_suite = {"QualityReporting",
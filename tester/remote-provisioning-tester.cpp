@@ -112,6 +112,46 @@ static void remote_provisioning_default_values(void) {
 	linphone_core_manager_destroy(marie);
 }
 
+static void remote_provisioning_unchanged_after_restart(void) {
+	LinphoneProxyConfig *lpc;
+	LinphoneCoreManager *marie = linphone_core_manager_new_with_proxies_check("marie_remote_default_values_rc", FALSE);
+	LpConfig *lp = linphone_core_get_config(marie->lc);
+	BC_ASSERT_TRUE(wait_for(marie->lc, NULL, &marie->stat.number_of_LinphoneConfiguringSuccessful, 1));
+	BC_ASSERT_PTR_NULL(linphone_config_get_string(lp, "misc", "config-uri-md5", NULL));
+
+	// By default the provisioning is applied on each start, overwriting local changes of provisioned values.
+	linphone_config_set_int(lp, "proxy_default_values", "reg_expires", 3600);
+	linphone_core_stop(marie->lc);
+	linphone_core_start(marie->lc);
+	BC_ASSERT_TRUE(wait_for(marie->lc, NULL, &marie->stat.number_of_LinphoneConfiguringSuccessful, 2));
+	lpc = linphone_core_create_proxy_config(marie->lc);
+	BC_ASSERT_EQUAL(linphone_proxy_config_get_expires(lpc), 604800, int, "%d");
+	linphone_proxy_config_unref(lpc);
+
+	// Once the cache is enabled, the provisioning is applied once more and its validators are stored.
+	linphone_config_set_bool(lp, "misc", "config-uri-cache", TRUE);
+	linphone_core_stop(marie->lc);
+	linphone_core_start(marie->lc);
+	BC_ASSERT_TRUE(wait_for(marie->lc, NULL, &marie->stat.number_of_LinphoneConfiguringSuccessful, 3));
+	BC_ASSERT_PTR_NOT_NULL(linphone_config_get_string(lp, "misc", "config-uri-md5", NULL));
+	BC_ASSERT_STRING_EQUAL(linphone_config_get_string(lp, "misc", "config-uri-cached", ""),
+	                       linphone_core_get_provisioning_uri(marie->lc));
+	ms_message("First cached provisioning took %llu ms",
+	           (unsigned long long)linphone_core_get_provisioning_duration(marie->lc));
+
+	// The provisioning did not change on the server: with the cache, it is not applied and local changes are kept.
+	linphone_config_set_int(lp, "proxy_default_values", "reg_expires", 3600);
+	linphone_core_stop(marie->lc);
+	linphone_core_start(marie->lc);
+	BC_ASSERT_TRUE(wait_for(marie->lc, NULL, &marie->stat.number_of_LinphoneConfiguringSuccessful, 4));
+	ms_message("Unchanged provisioning took %llu ms",
+	           (unsigned long long)linphone_core_get_provisioning_duration(marie->lc));
+	lpc = linphone_core_create_proxy_config(marie->lc);
+	BC_ASSERT_EQUAL(linphone_proxy_config_get_expires(lpc), 3600, int, "%d");
+	linphone_proxy_config_unref(lpc);
+	linphone_core_manager_destroy(marie);
+}
+
 static void remote_provisioning_file(void) {
 	LinphoneCoreManager *marie;
 	const LpConfig *conf;
@@ -470,6 +510,7 @@ test_t remote_provisioning_tests[] = {
     TEST_NO_TAG("Remote provisioning invalid", remote_provisioning_invalid),
     TEST_NO_TAG("Remote provisioning transient successful", remote_provisioning_transient),
     TEST_NO_TAG("Remote provisioning default values", remote_provisioning_default_values),
+    TEST_NO_TAG("Remote provisioning unchanged after restart", remote_provisioning_unchanged_after_restart),
     TEST_NO_TAG("Remote provisioning from file", remote_provisioning_file),
     TEST_NO_TAG("Remote provisioning invalid URI", remote_provisioning_invalid_uri),
     TEST_NO_TAG("Remote provisioning check if push tokens are not lost", remote_provisioning_check_push_params)
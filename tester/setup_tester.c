@@ -30,6 +30,7 @@
 #include "linphone/friendlist.h"
 #include "linphone/lpconfig.h"
 #include "tester_utils.h"
+#include "xml2lpc.h"
 
 #ifdef __APPLE__
 #include "TargetConditionals.h"
@@ -297,6 +298,120 @@ static void core_init_unref_test(void) {
 	}
 }
 
+static void core_wait_for_events_test(void) {
+	LinphoneCore *lc;
+	lc =
+	    linphone_factory_create_core_3(linphone_factory_get(), NULL, liblinphone_tester_get_empty_rc(), system_context);
+
+	if (BC_ASSERT_PTR_NOT_NULL(lc)) {
+		uint64_t start;
+		int wakeups = 0;
+
+		linphone_config_set_int(linphone_core_get_config(lc), "lime", "enabled", 0);
+		linphone_core_start(lc);
+		BC_ASSERT_EQUAL(linphone_core_get_global_state(lc), LinphoneGlobalOn, int, "%i");
+
+		/* Let the startup tasks (registrations, initial subscribes...) complete. */
+		start = bctbx_get_cur_time_ms();
+		while (linphone_core_get_next_iterate_delay(lc) <= 20 && bctbx_get_cur_time_ms() - start < 5000) {
+			linphone_core_iterate(lc);
+			ms_usleep(20000);
+		}
+		BC_ASSERT_GREATER(linphone_core_get_next_iterate_delay(lc), 20, int, "%d");
+
+		/* An idle core must not need to be woken up every 20ms. */
+		start = bctbx_get_cur_time_ms();
+		while (bctbx_get_cur_time_ms() - start < 3000) {
+			linphone_core_wait_for_events(lc, -1);
+			linphone_core_iterate(lc);
+			wakeups++;
+		}
+		ms_message("Idle core woke up %d times in 3 seconds", wakeups);
+		BC_ASSERT_LOWER(wakeups, 30, int, "%d");
+
+		linphone_core_unref(lc);
+	}
+}
+
+static LinphoneCore *create_core_in_group(const char *group) {
+	LinphoneConfig *config =
+	    linphone_factory_create_config_with_factory(linphone_factory_get(), NULL, liblinphone_tester_get_empty_rc());
+	LinphoneCore *lc;
+
+	linphone_config_set_int(config, "lime", "enabled", 0);
+	if (group) linphone_config_set_string(config, "misc", "core_group", group);
+	lc = linphone_factory_create_core_with_config_3(linphone_factory_get(), config, system_context);
+	linphone_config_unref(config);
+	linphone_core_start(lc);
+	return lc;
+}
+
+static void core_group_test(void) {
+	LinphoneCore *lc1 = create_core_in_group("setup-tester");
+	LinphoneCore *lc2 = create_core_in_group("setup-tester");
+	LinphoneCore *lc3 = create_core_in_group(NULL);
+
+	BC_ASSERT_PTR_EQUAL(sal_get_stack_impl(linphone_core_get_sal(lc1)), sal_get_stack_impl(linphone_core_get_sal(lc2)));
+	BC_ASSERT_PTR_NOT_EQUAL(sal_get_stack_impl(linphone_core_get_sal(lc1)),
+	                        sal_get_stack_impl(linphone_core_get_sal(lc3)));
+	BC_ASSERT_EQUAL(linphone_core_get_global_state(lc1), LinphoneGlobalOn, int, "%i");
+	BC_ASSERT_EQUAL(linphone_core_get_global_state(lc2), LinphoneGlobalOn, int, "%i");
+
+	/* The shared stack must outlive the core that created it. */
+	linphone_core_unref(lc1);
+	linphone_core_wait_for_events(lc2, 100);
+	linphone_core_iterate(lc2);
+	BC_ASSERT_EQUAL(linphone_core_get_global_state(lc2), LinphoneGlobalOn, int, "%i");
+
+	linphone_core_unref(lc2);
+	linphone_core_unref(lc3);
+}
+
+static void core_wait_for_events_wakes_up_on_sip_message(void) {
+	LinphoneCoreManager *marie = linphone_core_manager_new("marie_rc");
+	LinphoneCoreManager *pauline = linphone_core_manager_new("pauline_tcp_rc");
+	bctbx_list_t *lcs = bctbx_list_append(NULL, marie->lc);
+	uint64_t start;
+	int i;
+
+	lcs = bctbx_list_append(lcs, pauline->lc);
+
+	/* Let marie's core become idle, so that it would otherwise sleep for the whole idle delay. */
+	start = bctbx_get_cur_time_ms();
+	while (linphone_core_get_next_iterate_delay(marie->lc) < 500 && bctbx_get_cur_time_ms() - start < 10000) {
+		linphone_core_iterate(marie->lc);
+		linphone_core_iterate(pauline->lc);
+		ms_usleep(20000);
+	}
+	if (BC_ASSERT_GREATER(linphone_core_get_next_iterate_delay(marie->lc), 500, int, "%d")) {
+		LinphoneChatRoom *room = linphone_core_get_chat_room(pauline->lc, marie->identity);
+		LinphoneChatMessage *msg = linphone_chat_room_create_message_from_utf8(room, "Wake up");
+		int elapsed;
+
+		linphone_chat_message_send(msg);
+		/* Only pauline is iterated here, marie must notice the MESSAGE from within linphone_core_wait_for_events(). */
+		for (i = 0; i < 5; i++) {
+			linphone_core_iterate(pauline->lc);
+			ms_usleep(10000);
+		}
+		start = bctbx_get_cur_time_ms();
+		while (marie->stat.number_of_LinphoneMessageReceived == 0 && bctbx_get_cur_time_ms() - start < 5000) {
+			linphone_core_wait_for_events(marie->lc, -1);
+			linphone_core_iterate(marie->lc);
+		}
+		elapsed = (int)(bctbx_get_cur_time_ms() - start);
+		ms_message("Blocked core returned %d ms after the MESSAGE was sent", elapsed);
+		BC_ASSERT_EQUAL(marie->stat.number_of_LinphoneMessageReceived, 1, int, "%d");
+		BC_ASSERT_LOWER(elapsed, 500, int, "%d");
+		BC_ASSERT_TRUE(wait_for_list(lcs, &pauline->stat.number_of_LinphoneMessageDelivered, 1, 5000));
+		linphone_chat_message_unref(msg);
+	}
+
+	bctbx_list_free(lcs);
+	linphone_core_manager_destroy(marie);
+	linphone_core_manager_destroy(pauline);
+}
+
 static void core_init_stop_start_test(void) {
 	LinphoneCore *lc;
 	lc =
@@ -635,6 +750,63 @@ static void linphone_lpconfig_from_xml_zerolen_value(void) {
 	ms_free(xml_path);
 }
 
+static void linphone_lpconfig_from_xml_streamed(void) {
+	char *xml = bctbx_strdup("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+	                         "<config xmlns=\"http://www.linphone.org/xsds/lpconfig.xsd\">\n");
+	for (int i = 0; i < 500; i++) {
+		char *section = bctbx_strdup_printf("  <section name=\"section_%d\">\n"
+		                                    "    <entry name=\"overwritten\" overwrite=\"true\">value %d</entry>\n"
+		                                    "    <entry name=\"kept\">value %d &amp; more</entry>\n"
+		                                    "    <entry name=\"kept\">duplicate</entry>\n"
+		                                    "    <entry name=\"empty\" overwrite=\"true\"/>\n"
+		                                    "    <entry>no name</entry>\n"
+		                                    "  </section>\n",
+		                                    i, i, i);
+		char *tmp = bctbx_strdup_printf("%s%s", xml, section);
+		bctbx_free(xml);
+		bctbx_free(section);
+		xml = tmp;
+	}
+	char *tmp = bctbx_strdup_printf("%s%s", xml, "  <section><entry name=\"ignored\">1</entry></section>\n</config>\n");
+	bctbx_free(xml);
+	xml = tmp;
+
+	const char *rc = "[section_0]\noverwritten=old\nkept=old\nempty=old\n";
+	LpConfig *dom = linphone_config_new_from_buffer(rc);
+	LpConfig *streamed = linphone_config_new_from_buffer(rc);
+
+	// The streamed conversion gives the same config as the one walking the whole document.
+	xml2lpc_context *ctx = xml2lpc_context_new(NULL, NULL);
+	BC_ASSERT_EQUAL(xml2lpc_set_xml_string(ctx, xml), 0, int, "%d");
+	BC_ASSERT_EQUAL(xml2lpc_convert(ctx, dom), 0, int, "%d");
+	xml2lpc_context_destroy(ctx);
+	BC_ASSERT_EQUAL(linphone_config_load_from_xml_string(streamed, xml), 0, int, "%d");
+
+	char *domDump = linphone_config_dump(dom);
+	char *streamedDump = linphone_config_dump(streamed);
+	BC_ASSERT_STRING_EQUAL(streamedDump, domDump);
+	BC_ASSERT_STRING_EQUAL(linphone_config_get_string(streamed, "section_0", "overwritten", ""), "value 0");
+	BC_ASSERT_STRING_EQUAL(linphone_config_get_string(streamed, "section_0", "kept", ""), "old");
+	BC_ASSERT_PTR_NULL(linphone_config_get_string(streamed, "section_0", "empty", NULL));
+	BC_ASSERT_STRING_EQUAL(linphone_config_get_string(streamed, "section_1", "kept", ""), "value 1 & more");
+	bctbx_free(domDump);
+
+	// A truncated document is rejected before anything is applied.
+	xml[strlen(xml) / 2] = '\0';
+	linphone_config_set_string(streamed, "section_0", "overwritten", "local");
+	domDump = linphone_config_dump(streamed);
+	BC_ASSERT_NOT_EQUAL(linphone_config_load_from_xml_string(streamed, xml), 0, int, "%d");
+	bctbx_free(streamedDump);
+	streamedDump = linphone_config_dump(streamed);
+	BC_ASSERT_STRING_EQUAL(streamedDump, domDump);
+
+	bctbx_free(domDump);
+	bctbx_free(streamedDump);
+	bctbx_free(xml);
+	linphone_config_unref(dom);
+	linphone_config_unref(streamed);
+}
+
 void linphone_proxy_config_address_equal_test(void) {
 	LinphoneAddress *a = linphone_address_new("sip:toto@titi");
 	LinphoneAddress *b = linphone_address_new("sips:toto@titi");
@@ -3392,6 +3564,9 @@ test_t setup_tests[] = {
     TEST_NO_TAG("Linphone core init/stop/uninit", core_init_stop_test),
     TEST_NO_TAG("Linphone core init/unref", core_init_unref_test),
     TEST_NO_TAG("Linphone core init/stop/start/uninit", core_init_stop_start_test),
+    TEST_NO_TAG("Linphone core wait for events", core_wait_for_events_test),
+    TEST_NO_TAG("Linphone core wait for events wakes up on SIP message", core_wait_for_events_wakes_up_on_sip_message),
+    TEST_NO_TAG("Linphone core group", core_group_test),
     TEST_NO_TAG("Linphone core set user agent", core_set_user_agent),
     TEST_NO_TAG("Linphone random transport port", core_sip_transport_test),
     TEST_NO_TAG("Linphone interpret url", linphone_interpret_url_test),
@@ -3400,6 +3575,7 @@ test_t setup_tests[] = {
     TEST_NO_TAG("LPConfig zero_len value from buffer", linphone_lpconfig_from_buffer_zerolen_value),
     TEST_NO_TAG("LPConfig zero_len value from file", linphone_lpconfig_from_file_zerolen_value),
     TEST_NO_TAG("LPConfig zero_len value from XML", linphone_lpconfig_from_xml_zerolen_value),
+    TEST_NO_TAG("LPConfig streamed from XML", linphone_lpconfig_from_xml_streamed),
     TEST_NO_TAG("LPConfig invalid friend", linphone_lpconfig_invalid_friend),
     TEST_NO_TAG("LPConfig invalid friend remote provisoning", linphone_lpconfig_invalid_friend_remote_provisioning),
     TEST_NO_TAG("Chat room", chat_room_test),
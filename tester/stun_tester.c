@@ -529,6 +529,83 @@ end:
 	bctbx_list_free(lcs);
 }
 
+static bool_t ice_check_list_has_remote_candidate(const IceCheckList *cl, IceCandidateType type) {
+	const bctbx_list_t *it;
+	for (it = cl->remote_candidates; it != NULL; it = bctbx_list_next(it)) {
+		if (((const IceCandidate *)bctbx_list_get_data(it))->type == type) return TRUE;
+	}
+	return FALSE;
+}
+
+/*
+ * The caller sends its offer with the host candidates only, then its relay candidate in a re-INVITE once the TURN
+ * allocation is done. Once the check lists complete, the usual ICE re-INVITE follows, and nothing else.
+ */
+static void ice_turn_call_with_early_offer(void) {
+	LinphoneCoreManager *marie;
+	LinphoneCoreManager *pauline;
+	LinphoneCall *marie_call;
+	LinphoneCall *pauline_call;
+	IceSession *ice_session = NULL;
+	IceCheckList *cl;
+	bctbx_list_t *lcs = NULL;
+	int attempts;
+
+	marie = linphone_core_manager_create(transport_supported(LinphoneTransportTls) ? "marie_sips_rc" : "marie_rc");
+	lcs = bctbx_list_append(lcs, marie->lc);
+	pauline = linphone_core_manager_create(transport_supported(LinphoneTransportTls) ? "pauline_rc" : "pauline_tcp_rc");
+	lcs = bctbx_list_append(lcs, pauline->lc);
+
+	linphone_core_enable_ipv6(marie->lc, FALSE);
+	linphone_core_enable_ipv6(pauline->lc, FALSE);
+	configure_nat_policy(marie->lc, TRUE, FALSE, FALSE);
+	configure_nat_policy(pauline->lc, FALSE, FALSE, FALSE);
+	linphone_config_set_int(linphone_core_get_config(marie->lc), "net", "ice_early_offer", 1);
+
+	linphone_core_manager_start(marie, TRUE);
+	linphone_core_manager_start(pauline, TRUE);
+
+	linphone_core_invite_address(marie->lc, pauline->identity);
+	BC_ASSERT_TRUE(wait_for_list(lcs, &pauline->stat.number_of_LinphoneCallIncomingReceived, 1, 10000));
+	marie_call = linphone_core_get_current_call(marie->lc);
+	pauline_call = linphone_core_get_current_call(pauline->lc);
+	BC_ASSERT_PTR_NOT_NULL(marie_call);
+	BC_ASSERT_PTR_NOT_NULL(pauline_call);
+	if (marie_call) ice_session = linphone_call_get_ice_session(marie_call);
+	BC_ASSERT_PTR_NOT_NULL(ice_session);
+	if (!pauline_call || !ice_session) goto end;
+
+	/* Let the TURN allocation finish before answering, so that the relay candidate comes in its own re-INVITE */
+	for (attempts = 0; !ice_session_candidates_gathered(ice_session) && attempts < 100; ++attempts)
+		wait_for_list(lcs, NULL, 0, 100);
+	BC_ASSERT_TRUE(ice_session_candidates_gathered(ice_session));
+	linphone_call_accept(pauline_call);
+
+	/* One re-INVITE for the late candidates, one for the ICE completion */
+	BC_ASSERT_TRUE(wait_for_list(lcs, &pauline->stat.number_of_LinphoneCallUpdatedByRemote, 2, 10000));
+	BC_ASSERT_TRUE(wait_for_list(lcs, &marie->stat.number_of_LinphoneCallStreamsRunning, 3, 10000));
+	BC_ASSERT_TRUE(wait_for_list(lcs, &pauline->stat.number_of_LinphoneCallStreamsRunning, 3, 10000));
+	wait_for_list(lcs, NULL, 0, 2000);
+	BC_ASSERT_EQUAL(marie->stat.number_of_LinphoneCallUpdating, 2, int, "%d");
+	BC_ASSERT_EQUAL(pauline->stat.number_of_LinphoneCallUpdatedByRemote, 2, int, "%d");
+
+	/* The check lists completed on the host pair, while the relay candidate was allocated and advertised */
+	BC_ASSERT_TRUE(check_ice(marie, pauline, LinphoneIceStateHostConnection));
+	cl = ice_session_check_list(ice_session, 0);
+	BC_ASSERT_PTR_NOT_NULL(cl);
+	if (cl) BC_ASSERT_TRUE(cl->rtp_turn_context && cl->rtp_turn_context->stats.nb_successful_allocate > 0);
+	cl = ice_session_check_list(linphone_call_get_ice_session(pauline_call), 0);
+	BC_ASSERT_PTR_NOT_NULL(cl);
+	if (cl) BC_ASSERT_TRUE(ice_check_list_has_remote_candidate(cl, ICT_RelayedCandidate));
+
+	end_call(marie, pauline);
+
+end:
+	linphone_core_manager_destroy(pauline);
+	linphone_core_manager_destroy(marie);
+	bctbx_list_free(lcs);
+}
+
 static void relayed_ice_turn_to_turn_with_dtls_srtp(void) {
 	CallConfig cfg = {0};
 	cfg.forced_relay = TRUE;
@@ -555,6 +632,7 @@ test_t stun_tests[] = {
     TEST_TWO_TAGS("Relayed ICE+TURN call with TLS", relayed_ice_turn_call_with_tls, "ICE", "TURN"),
     TEST_TWO_TAGS("Relayed ICE+TURN call with rtcp-mux", relayed_ice_turn_call_with_rtcp_mux, "ICE", "TURN"),
     TEST_TWO_TAGS("Relayed ICE+TURN to ICE+STUN call", relayed_ice_turn_to_ice_stun_call, "ICE", "TURN"),
+    TEST_TWO_TAGS("ICE+TURN call with early offer", ice_turn_call_with_early_offer, "ICE", "TURN"),
     TEST_TWO_TAGS("Relayed ICE+TURN call with SRTP", relayed_ice_turn_call_with_srtp, "ICE", "TURN"),
     TEST_TWO_TAGS("Relayed ICE+TURN TLS call with SRTP", relayed_ice_turn_tls_with_srtp, "ICE", "TURN"),
     TEST_TWO_TAGS("Relayed ICE+TURN TLS call to ICE with SRTP", relayed_ice_turn_tls_to_ice_with_srtp, "ICE", "TURN"),
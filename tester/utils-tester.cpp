@@ -18,9 +18,16 @@
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <map>
+#include <set>
+
 #include "bctoolbox/utils.hh"
 
+#include "account/account-registration-scheduler.h"
 #include "address/address.h"
+#include "chat/modifier/file-transfer-scheduler.h"
+#include "conference/session/rtp-port-allocator.h"
+#include "core/core-settings.h"
 #include "liblinphone_tester.h"
 #include "linphone/utils/utils.h"
 #include "tester_utils.h"
@@ -150,6 +157,189 @@ static void parse_capabilities(void) {
 	BC_ASSERT_TRUE(caps["ephemeral"] == Version(1, 0));
 }
 
+static void file_transfer_scheduler(void) {
+	FileTransferScheduler scheduler(2, 1);
+	vector<int> started;
+	int owners[5];
+
+	scheduler.submit(&owners[0], FileTransferScheduler::Direction::Upload, FileTransferScheduler::Priority::Normal,
+	                 [&started]() { started.push_back(0); });
+	scheduler.submit(&owners[1], FileTransferScheduler::Direction::Upload, FileTransferScheduler::Priority::Low,
+	                 [&started]() { started.push_back(1); });
+	scheduler.submit(&owners[2], FileTransferScheduler::Direction::Upload, FileTransferScheduler::Priority::Low,
+	                 [&started]() { started.push_back(2); });
+	scheduler.submit(&owners[3], FileTransferScheduler::Direction::Upload, FileTransferScheduler::Priority::Normal,
+	                 [&started]() { started.push_back(3); });
+	scheduler.submit(&owners[4], FileTransferScheduler::Direction::Download, FileTransferScheduler::Priority::Normal,
+	                 [&started]() { started.push_back(4); });
+	BC_ASSERT_EQUAL((int)started.size(), 3, int, "%d");
+	BC_ASSERT_EQUAL((int)scheduler.getRunningCount(FileTransferScheduler::Direction::Upload), 2, int, "%d");
+	BC_ASSERT_EQUAL((int)scheduler.getQueuedCount(FileTransferScheduler::Direction::Upload), 2, int, "%d");
+	BC_ASSERT_EQUAL((int)scheduler.getRunningCount(FileTransferScheduler::Direction::Download), 1, int, "%d");
+
+	// The queued normal priority upload goes before the low priority one submitted earlier.
+	scheduler.release(&owners[0]);
+	BC_ASSERT_EQUAL(started.back(), 3, int, "%d");
+
+	// Releasing a queued transfer forgets it.
+	scheduler.release(&owners[2]);
+	BC_ASSERT_EQUAL((int)scheduler.getQueuedCount(FileTransferScheduler::Direction::Upload), 0, int, "%d");
+	scheduler.release(&owners[1]);
+	scheduler.release(&owners[3]);
+	scheduler.release(&owners[4]);
+	BC_ASSERT_EQUAL((int)started.size(), 4, int, "%d");
+	BC_ASSERT_EQUAL((int)scheduler.getRunningCount(FileTransferScheduler::Direction::Upload), 0, int, "%d");
+}
+
+static void core_settings_snapshot(void) {
+	LinphoneConfig *config = linphone_config_new_from_buffer("[sip]\nkeep_srtp_keys=0\n[rtp]\nbind_address=10.0.0.1\n");
+	CoreSettings settings(config);
+	BC_ASSERT_FALSE(settings.sip.keepSrtpKeys);
+	BC_ASSERT_STRING_EQUAL(settings.rtp.bindAddress.c_str(), "10.0.0.1");
+	BC_ASSERT_EQUAL(settings.net.dtmfDelayMs, 200, int, "%d");
+	BC_ASSERT_EQUAL(settings.sip.keepSdpVersion, -1, int, "%d");
+	BC_ASSERT_FALSE(settings.isOutdated(config));
+
+	// Writing an unchanged value keeps the snapshot valid.
+	linphone_config_set_int(config, "sip", "keep_srtp_keys", 0);
+	BC_ASSERT_FALSE(settings.isOutdated(config));
+
+	linphone_config_set_int(config, "net", "dtmf_delay_ms", 50);
+	BC_ASSERT_TRUE(settings.isOutdated(config));
+	CoreSettings updated(config);
+	BC_ASSERT_EQUAL(updated.net.dtmfDelayMs, 50, int, "%d");
+
+	linphone_config_clean_entry(config, "rtp", "bind_address");
+	BC_ASSERT_TRUE(updated.isOutdated(config));
+	BC_ASSERT_TRUE(CoreSettings(config).rtp.bindAddress.empty());
+	linphone_config_unref(config);
+}
+
+static void rtp_port_allocator(void) {
+	RtpPortAllocator allocator;
+	set<int> reserved;
+
+	// Fill most of a range of 2000 pairs, every pair must be distinct and start on an even port.
+	uint64_t startTime = bctbx_get_cur_time_ms();
+	for (int i = 0; i < 1900; i++) {
+		int port = allocator.reserve(make_pair(20000, 23999));
+		BC_ASSERT_TRUE((port >= 20000) && (port < 23999) && (port % 2 == 0));
+		BC_ASSERT_TRUE(reserved.insert(port).second);
+	}
+	ms_message("Reserved %d RTP port pairs in %d ms", (int)reserved.size(),
+	           (int)(bctbx_get_cur_time_ms() - startTime));
+	BC_ASSERT_EQUAL((int)allocator.getReservedCount(), 1900, int, "%d");
+
+	// Release and reserve again many times, the allocator must never hand out a pair that is still in use.
+	for (int i = 0; i < 5000; i++) {
+		auto it = reserved.begin();
+		advance(it, i % reserved.size());
+		allocator.release(*it);
+		BC_ASSERT_FALSE(allocator.isUsed(*it));
+		reserved.erase(it);
+		int port = allocator.reserve(make_pair(20000, 23999));
+		if (!BC_ASSERT_TRUE(reserved.insert(port).second)) break;
+	}
+	BC_ASSERT_EQUAL((int)allocator.getReservedCount(), 1900, int, "%d");
+	BC_ASSERT_EQUAL((int)allocator.getExhaustionCount(), 0, int, "%d");
+
+	// The last free pairs of the range are found, then the range is exhausted.
+	for (int i = 0; i < 100; i++)
+		BC_ASSERT_NOT_EQUAL(allocator.reserve(make_pair(20000, 23999)), -1, int, "%d");
+	BC_ASSERT_EQUAL(allocator.reserve(make_pair(20000, 23999)), -1, int, "%d");
+	BC_ASSERT_EQUAL((int)allocator.getExhaustionCount(), 1, int, "%d");
+
+	// A fixed port gives the lowest free pair from that port.
+	BC_ASSERT_EQUAL(allocator.reserve(make_pair(7078, 7078)), 7078, int, "%d");
+	BC_ASSERT_EQUAL(allocator.reserve(make_pair(7078, 7078)), 7080, int, "%d");
+	allocator.release(7078);
+	BC_ASSERT_EQUAL(allocator.reserve(make_pair(7078, 7078)), 7078, int, "%d");
+	BC_ASSERT_TRUE(allocator.isUsed(7079));
+}
+
+// Plays the role of a registrar answering each REGISTER after a round trip, for accounts that refresh their
+// registration at 90% of the expires. Returns the peak of REGISTERs started within one second.
+static size_t simulate_registrations(AccountRegistrationScheduler &scheduler,
+                                     vector<int> &accounts,
+                                     uint64_t durationMs,
+                                     int expires,
+                                     map<void *, int> &registerCounts) {
+	const uint64_t stepMs = 10;
+	map<uint64_t, size_t> startedPerSecond;
+	multimap<uint64_t, void *> answers;
+	for (auto &account : accounts)
+		scheduler.schedule(&account, 0);
+
+	for (uint64_t now = 0; now <= durationMs; now += stepMs) {
+		for (auto it = answers.begin(); (it != answers.end()) && (it->first <= now); it = answers.erase(it)) {
+			scheduler.transactionFinished(it->second);
+			scheduler.scheduleAt(it->second, now + (uint64_t)expires * 900);
+		}
+		for (auto key : scheduler.collectDue(now)) {
+			registerCounts[key]++;
+			startedPerSecond[now / 1000]++;
+			answers.emplace(now + 50 + bctbx_random() % 150, key);
+		}
+	}
+
+	size_t peakPerSecond = 0;
+	for (const auto &second : startedPerSecond)
+		peakPerSecond = max(peakPerSecond, second.second);
+	return peakPerSecond;
+}
+
+static void account_registration_scheduler(void) {
+	vector<int> accounts(1000);
+	const int expires = 600;
+	const uint64_t duration = expires * 1000;
+
+	// Without limit nor spread, every account registers at once and refreshes at the same time.
+	map<void *, int> burstCounts;
+	AccountRegistrationScheduler burst(0, 0);
+	size_t burstPeakPerSecond = simulate_registrations(burst, accounts, duration, expires, burstCounts);
+	ms_message("Without scheduling: peak of %d concurrent REGISTER transactions, %d REGISTERs in one second",
+	           (int)burst.getPeakInFlightCount(), (int)burstPeakPerSecond);
+	BC_ASSERT_EQUAL((int)burst.getPeakInFlightCount(), 1000, int, "%d");
+
+	map<void *, int> registerCounts;
+	AccountRegistrationScheduler scheduler(10, 10000);
+	uint64_t startTime = bctbx_get_cur_time_ms();
+	size_t peakPerSecond = simulate_registrations(scheduler, accounts, duration, expires, registerCounts);
+	ms_message("With scheduling: peak of %d concurrent REGISTER transactions, %d REGISTERs in one second "
+	           "(simulated in %d ms)",
+	           (int)scheduler.getPeakInFlightCount(), (int)peakPerSecond, (int)(bctbx_get_cur_time_ms() - startTime));
+	BC_ASSERT_LOWER((int)scheduler.getPeakInFlightCount(), 10, int, "%d");
+	BC_ASSERT_LOWER((int)peakPerSecond, (int)burstPeakPerSecond / 5, int, "%d");
+	// Every account registered, then refreshed its registration.
+	BC_ASSERT_EQUAL((int)registerCounts.size(), 1000, int, "%d");
+	for (const auto &count : registerCounts)
+		if (!BC_ASSERT_EQUAL(count.second, 2, int, "%d")) break;
+
+	// Deadlines further than one turn of the wheel are kept until their time.
+	AccountRegistrationScheduler wheel(0, 0, 100, 16);
+	int first = 0, second = 0;
+	wheel.scheduleAt(&first, 10000);
+	wheel.scheduleAt(&second, 500);
+	BC_ASSERT_TRUE(wheel.collectDue(100).empty());
+	list<AccountRegistrationScheduler::Key> due = wheel.collectDue(1600);
+	BC_ASSERT_EQUAL((int)due.size(), 1, int, "%d");
+	BC_ASSERT_TRUE(!due.empty() && (due.front() == &second));
+	BC_ASSERT_TRUE(wheel.collectDue(9900).empty());
+	BC_ASSERT_EQUAL((int)wheel.collectDue(10000).size(), 1, int, "%d");
+
+	// An unscheduled account is forgotten, an unanswered registration stops holding its slot after a while.
+	AccountRegistrationScheduler capped(1, 0);
+	capped.scheduleAt(&first, 0);
+	capped.scheduleAt(&second, 0);
+	BC_ASSERT_EQUAL((int)capped.collectDue(0).size(), 1, int, "%d");
+	BC_ASSERT_TRUE(capped.collectDue(1000).empty());
+	BC_ASSERT_EQUAL((int)capped.collectDue(40000).size(), 1, int, "%d");
+	capped.unschedule(&first);
+	capped.unschedule(&second);
+	BC_ASSERT_EQUAL((int)capped.getInFlightCount(), 0, int, "%d");
+	BC_ASSERT_EQUAL((int)capped.getScheduledCount(), 0, int, "%d");
+}
+
 // clang-format off
 test_t utils_tests[] = {
     TEST_NO_TAG("split", split),
@@ -157,7 +347,11 @@ test_t utils_tests[] = {
     TEST_NO_TAG("Version comparisons", version_comparisons),
     TEST_NO_TAG("Address comparisons", address_comparisons),
     TEST_NO_TAG("Conference ID comparisons", conferenceId_comparisons),
-    TEST_NO_TAG("Parse capabilities", parse_capabilities)
+    TEST_NO_TAG("Parse capabilities", parse_capabilities),
+    TEST_NO_TAG("File transfer scheduler", file_transfer_scheduler),
+    TEST_NO_TAG("Core settings snapshot", core_settings_snapshot),
+    TEST_NO_TAG("RTP port allocator", rtp_port_allocator),
+    TEST_NO_TAG("Account registration scheduler", account_registration_scheduler)
 };
 // clang-format on
 
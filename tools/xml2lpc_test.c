@@ -19,8 +19,13 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
 
 #include "bctoolbox/defs.h"
+#include "bctoolbox/port.h"
 
 #include "xml2lpc.h"
 
@@ -48,8 +53,66 @@ void cb_function(BCTBX_UNUSED(void *ctx), xml2lpc_log_level level, const char *m
 void show_usage(BCTBX_UNUSED(int argc), char *argv[]) {
 	fprintf(stderr,
 	        "usage %s convert <xml_file> <lpc_file>\n"
-	        "      %s validate <xml_file> <xsd_file>\n",
-	        argv[0], argv[0]);
+	        "      %s validate <xml_file> <xsd_file>\n"
+	        "      %s generate <xml_file> <size_in_mb>\n"
+	        "      %s bench <xml_file> <dom|stream>\n",
+	        argv[0], argv[0], argv[0], argv[0]);
+}
+
+/* Writes a provisioning document made of many accounts, friends and certificate blobs. */
+static int generate(const char *filename, int sizeInMb) {
+	FILE *f = fopen(filename, "w");
+	long target = (long)sizeInMb * 1024 * 1024;
+	int i;
+	if (!f) return -1;
+
+	fprintf(f, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+	fprintf(f, "<config xmlns=\"http://www.linphone.org/xsds/lpconfig.xsd\">\n");
+	for (i = 0; ftell(f) < target; i++) {
+		int j;
+		fprintf(f, "  <section name=\"proxy_%d\">\n", i);
+		fprintf(f, "    <entry name=\"reg_identity\" overwrite=\"true\">sip:user%d@sip.example.org</entry>\n", i);
+		fprintf(f, "    <entry name=\"reg_proxy\">&lt;sip:sip.example.org;transport=tls&gt;</entry>\n");
+		fprintf(f, "    <entry name=\"reg_expires\">3600</entry>\n  </section>\n");
+		fprintf(f, "  <section name=\"friend_%d\">\n", i);
+		fprintf(f, "    <entry name=\"url\">\"Friend %d\" &lt;sip:friend%d@sip.example.org&gt;</entry>\n", i, i);
+		fprintf(f, "    <entry name=\"subscribe\">1</entry>\n  </section>\n");
+		fprintf(f, "  <section name=\"certificate_%d\">\n    <entry name=\"pem\">", i);
+		for (j = 0; j < 4096; j++)
+			fputc("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"[(i + j * 7) % 64], f);
+		fprintf(f, "</entry>\n  </section>\n");
+	}
+	fprintf(f, "</config>\n");
+	fclose(f);
+	return 0;
+}
+
+/* Peak RSS is per process: run the dom and stream conversions in separate processes to compare them. */
+static int bench(const char *filename, const char *mode) {
+	LpConfig *lpc = linphone_config_new(NULL);
+	xml2lpc_context *ctx = xml2lpc_context_new(NULL, NULL);
+	uint64_t start = bctbx_get_cur_time_ms();
+	int ret;
+
+	if (strcmp(mode, "stream") == 0) {
+		ret = xml2lpc_convert_xml_file(ctx, lpc, filename);
+	} else {
+		ret = xml2lpc_set_xml_file(ctx, filename);
+		if (ret == 0) ret = xml2lpc_convert(ctx, lpc);
+	}
+	fprintf(stdout, "%s: ret %d, %d ms", mode, ret, (int)(bctbx_get_cur_time_ms() - start));
+#ifndef _WIN32
+	{
+		struct rusage usage;
+		getrusage(RUSAGE_SELF, &usage);
+		/* kilobytes on Linux, bytes on macOS */
+		fprintf(stdout, ", peak RSS %ld", (long)usage.ru_maxrss);
+	}
+#endif
+	fprintf(stdout, "\n");
+	xml2lpc_context_destroy(ctx);
+	linphone_config_destroy(lpc);
+	return ret;
 }
 
 int main(int argc, char *argv[]) {
@@ -59,6 +122,12 @@ int main(int argc, char *argv[]) {
 		return -1;
 	}
 
+	if (strcmp("generate", argv[1]) == 0) {
+		return generate(argv[2], atoi(argv[3]));
+	} else if (strcmp("bench", argv[1]) == 0) {
+		return bench(argv[2], argv[3]);
+	}
+
 	ctx = xml2lpc_context_new(cb_function, NULL);
 	xml2lpc_set_xml_file(ctx, argv[2]);
 	if (strcmp("convert", argv[1]) == 0) {